@@ -0,0 +1,379 @@
+/**
+ * @file	async_writer.hpp
+ * @author	radj307
+ * @brief	Contains the async_writer object, which writes to a file from a dedicated background thread so that producer threads never block on disk I/O.
+ */
+#pragma once
+#include <sysarch.h>
+#include <buffered_writer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace file {
+	/**
+	 * @enum	overflow_policy
+	 * @brief	Determines what an async_writer does with new data when its queue is full.
+	 */
+	enum class overflow_policy : unsigned char {
+		/// @brief	The producer waits until the background thread has made room in the queue.
+		Block,
+		/// @brief	The data is discarded, and the write returns false. The number of dropped writes is counted.
+		Drop,
+		/// @brief	The data is stored in an unbounded overflow list, which is protected by a mutex; the producer never waits for disk I/O.
+		Grow,
+	};
+
+	namespace _internal {
+		/**
+		 * @class	mpsc_ring
+		 * @brief	A lock-free bounded queue that supports any number of producers, and exactly one consumer.
+		 *\n		Each element is given a ticket when it's pushed, which is its position in the order that elements are popped.
+		 *\n		This is based on Dmitry Vyukov's bounded MPMC queue, with a consumer side that doesn't need to be atomic.
+		 */
+		template<class T>
+		class mpsc_ring {
+			struct slot {
+				std::atomic<size_t> sequence;
+				T value;
+			};
+
+			std::unique_ptr<slot[]> slots;
+			size_t mask;
+			// the producer & consumer counters are kept on separate cache lines so they don't invalidate each other
+			alignas(64) std::atomic<size_t> enqueuePos{ 0 };
+			alignas(64) size_t dequeuePos{ 0 };
+
+		public:
+			/// @param capacity	The maximum number of elements; this is rounded up to a power of 2.
+			explicit mpsc_ring(size_t const capacity) :
+				slots{ std::make_unique<slot[]>(std::bit_ceil(std::max<size_t>(capacity, 2))) },
+				mask{ std::bit_ceil(std::max<size_t>(capacity, 2)) - 1 }
+			{
+				for (size_t i{ 0 }; i <= mask; ++i)
+					slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+
+			/// @returns	The maximum number of elements in the queue.
+			size_t capacity() const noexcept { return mask + 1; }
+
+			/**
+			 * @brief			Pushes an element onto the queue. May be called from any thread.
+			 * @param value		The element to push. It's only moved from when the push succeeds.
+			 * @param ticket	Receives the next ticket to be handed out when the queue is full; every element with an earlier ticket has already been pushed or is being pushed.
+			 * @returns			true when the element was pushed; false when the queue is full.
+			 */
+			bool try_push(T& value, size_t& ticket) noexcept(std::is_nothrow_move_assignable_v<T>)
+			{
+				size_t pos{ enqueuePos.load(std::memory_order_relaxed) };
+				while (true) {
+					slot& s{ slots[pos & mask] };
+					const size_t seq{ s.sequence.load(std::memory_order_acquire) };
+					const auto diff{ static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos) };
+					if (diff == 0) {
+						if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+							s.value = std::move(value);
+							s.sequence.store(pos + 1, std::memory_order_release);
+							return true;
+						}
+					}
+					else if (diff < 0) {
+						ticket = pos;
+						return false;
+					}
+					else pos = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+			/**
+			 * @brief		Pops the next element from the queue. Must only be called from the consumer thread.
+			 * @param out	Receives the element.
+			 * @returns		true when an element was popped; false when the queue is empty, or the next element hasn't finished being pushed yet.
+			 */
+			bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>)
+			{
+				slot& s{ slots[dequeuePos & mask] };
+				if (s.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+					return false;
+				out = std::move(s.value);
+				s.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+				++dequeuePos;
+				return true;
+			}
+
+			/// @returns	The ticket of the next element to be popped. Must only be called from the consumer thread.
+			size_t head() const noexcept { return dequeuePos; }
+			/// @returns	true when elements have been given tickets that the consumer hasn't popped yet. Must only be called from the consumer thread.
+			bool has_pending() const noexcept { return enqueuePos.load(std::memory_order_acquire) != dequeuePos; }
+		};
+	}
+
+	/**
+	 * @class	async_writer
+	 * @brief	Writes data to a file from a dedicated background thread.
+	 *\n		Producers copy their data into a lock-free bounded queue & return immediately; the background thread
+	 *\n		 coalesces everything in the queue into large writes through a buffered_writer.
+	 *\n		Data written by one thread always appears in the file in the same order it was written in.
+	 *\n		When the queue is full, the overflow_policy determines whether producers wait, drop the data, or store it in an unbounded overflow list.
+	 *\n		The destructor writes everything that was queued before closing the file.
+	 */
+	class async_writer {
+		struct message {
+			std::string data;
+			/// @brief	When this isn't nullptr, the message is a barrier; the buffer is flushed, then the result is stored in the promise.
+			std::promise<bool>* barrier{ nullptr };
+			/// @brief	When true, the barrier also waits for the file to be written to the storage device.
+			bool sync{ false };
+			/// @brief	The ticket that this message must be written before; only used by messages in the overflow list.
+			size_t ticket{ 0 };
+		};
+
+		buffered_writer writer;
+		overflow_policy policy;
+		_internal::mpsc_ring<message> ring;
+
+		std::mutex overflowMutex;
+		std::deque<message> overflow;
+		std::atomic<size_t> overflowCount{ 0 };
+		/// @brief	Messages taken from the overflow list by the consumer; only accessed by the consumer thread.
+		std::deque<message> spilled;
+
+		/// @brief	Incremented for every message that's queued, so the consumer can wait for it to change.
+		std::atomic<uint32_t> queued{ 0 };
+		std::atomic<bool> consumerWaiting{ false };
+		/// @brief	Incremented whenever the consumer makes room in the queue, so blocked producers can wait for it to change.
+		std::atomic<uint32_t> consumed{ 0 };
+		std::atomic<size_t> blockedProducers{ 0 };
+
+		std::atomic<size_t> droppedCount{ 0 };
+		std::atomic<bool> failed{ false };
+		std::atomic<bool> stopping{ false };
+		std::thread consumer;
+
+		void notify_consumer() noexcept
+		{
+			queued.fetch_add(1);
+			// only the first producer after the consumer goes to sleep needs to wake it up
+			if (consumerWaiting.load() && consumerWaiting.exchange(false))
+				queued.notify_one();
+		}
+
+		/**
+		 * @brief			Queues a message according to the given policy.
+		 * @returns			true when the message was queued; false when it was dropped.
+		 */
+		bool enqueue(message& msg, overflow_policy const& overflowPolicy)
+		{
+			size_t ticket;
+			while (true) {
+				const auto& lastConsumed{ consumed.load() };
+				if (ring.try_push(msg, ticket)) {
+					notify_consumer();
+					return true;
+				}
+				if (overflowPolicy == overflow_policy::Drop) {
+					droppedCount.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				if (overflowPolicy == overflow_policy::Grow)
+					break;
+				blockedProducers.fetch_add(1);
+				consumed.wait(lastConsumed);
+				blockedProducers.fetch_sub(1);
+			}
+
+			// every message with an earlier ticket was pushed before this one, and every later message from this thread gets a later ticket
+			msg.ticket = ticket;
+			{
+				std::scoped_lock<std::mutex> lock(overflowMutex);
+				overflow.emplace_back(std::move(msg));
+				overflowCount.fetch_add(1, std::memory_order_release);
+			}
+			notify_consumer();
+			return true;
+		}
+
+		/// @brief	Writes a message to the buffered writer, or handles a barrier.
+		void process(message& msg)
+		{
+			if (msg.barrier != nullptr) {
+				const bool result{ (msg.sync ? writer.sync() : writer.flush()) && !failed.load(std::memory_order_relaxed) };
+				msg.barrier->set_value(result);
+			}
+			else if (!writer.write(msg.data))
+				failed.store(true, std::memory_order_relaxed);
+		}
+
+		/// @brief	Moves the messages in the overflow list into the spilled list, sorted by ticket.
+		void merge_overflow()
+		{
+			std::scoped_lock<std::mutex> lock(overflowMutex);
+			// messages from different threads may arrive out of ticket order; each thread's tickets never decrease, so a stable insert keeps them in order
+			for (auto& it : overflow)
+				spilled.insert(std::upper_bound(spilled.begin(), spilled.end(), it.ticket, [](size_t const ticket, message const& m) { return ticket < m.ticket; }), std::move(it));
+			overflow.clear();
+			overflowCount.store(0, std::memory_order_release);
+		}
+
+		/**
+		 * @brief	Processes every message that's currently queued, in ticket order.
+		 *\n		A message from the overflow list is written after every message in the ring with an earlier ticket, and before the message with the same ticket.
+		 * @returns	true when at least one message was processed.
+		 */
+		bool drain()
+		{
+			bool any{ false };
+			message msg;
+			while (true) {
+				if (overflowCount.load(std::memory_order_acquire) != 0)
+					merge_overflow();
+
+				if (!spilled.empty() && spilled.front().ticket <= ring.head()) {
+					process(spilled.front());
+					spilled.pop_front();
+				}
+				else if (const size_t ticket{ ring.head() }; ring.try_pop(msg)) {
+					// the producer of this message may have spilled an earlier one after the overflow list was checked above;
+					//  popping the message synchronizes with its producer, so that spill is visible now
+					if (overflowCount.load(std::memory_order_acquire) != 0) {
+						merge_overflow();
+						for (; !spilled.empty() && spilled.front().ticket <= ticket; spilled.pop_front())
+							process(spilled.front());
+					}
+					process(msg);
+					consumed.fetch_add(1);
+					if (blockedProducers.load() != 0)
+						consumed.notify_all();
+				}
+				else if (ring.has_pending()) {
+					// a producer has taken a ticket, but hasn't finished writing its message yet
+					std::this_thread::yield();
+					continue;
+				}
+				else return any;
+				any = true;
+			}
+		}
+
+		void consumer_main()
+		{
+			while (true) {
+				const auto& lastQueued{ queued.load() };
+				if (drain())
+					continue;
+				if (stopping.load()) {
+					// messages queued before the writer was stopped may have arrived after the last drain
+					drain();
+					break;
+				}
+				// write whatever was coalesced, now that there's nothing else to do
+				if (!writer.flush())
+					failed.store(true, std::memory_order_relaxed);
+
+				consumerWaiting.store(true);
+				queued.wait(lastQueued);
+				consumerWaiting.store(false);
+			}
+			if (!writer.close())
+				failed.store(true, std::memory_order_relaxed);
+		}
+
+		bool barrier(bool const sync)
+		{
+			std::promise<bool> promise;
+			auto future{ promise.get_future() };
+			message msg{ {}, &promise, sync };
+			// barriers are never dropped
+			enqueue(msg, policy == overflow_policy::Grow ? overflow_policy::Grow : overflow_policy::Block);
+			return future.get();
+		}
+
+	public:
+		/// @brief	The default maximum number of queued writes.
+		static constexpr size_t DEFAULT_QUEUE_CAPACITY{ 8192 };
+		/// @brief	The default size of the background thread's write buffer, in bytes; 1 MiB.
+		static constexpr size_t DEFAULT_BUFFER_SIZE{ 1024ull * 1024ull };
+
+		/**
+		 * @brief					Opens the specified file for writing, creating it if it doesn't exist, and starts the background thread.
+		 * @param path				The location of the target file.
+		 * @param append			When true, data is appended to the end of the file; otherwise, the file is truncated when it's opened.
+		 * @param policy			What to do when the queue is full.
+		 * @param queueCapacity		The maximum number of queued writes; this is rounded up to a power of 2.
+		 * @param bufferSize		The size of the buffer used to coalesce writes, in bytes.
+		 * @throws std::filesystem::filesystem_error	The file couldn't be opened.
+		 */
+		explicit async_writer(std::filesystem::path const& path, bool const append = true, overflow_policy const& policy = overflow_policy::Block, size_t const queueCapacity = DEFAULT_QUEUE_CAPACITY, size_t const bufferSize = DEFAULT_BUFFER_SIZE) noexcept(false) :
+			writer{ path, append, bufferSize },
+			policy{ policy },
+			ring{ queueCapacity },
+			consumer{ &async_writer::consumer_main, this }
+		{}
+		async_writer(async_writer const&) = delete;
+		async_writer& operator=(async_writer const&) = delete;
+		/**
+		 * @brief	Writes everything that was queued, then closes the file & joins the background thread.
+		 *\n		No other thread may be writing when the writer is destroyed.
+		 */
+		~async_writer()
+		{
+			stopping.store(true);
+			notify_consumer();
+			consumer.join();
+		}
+
+		/**
+		 * @brief		Queues data to be written to the file. This never waits for disk I/O.
+		 *\n			When the queue is full, this waits for room, drops the data, or stores it in the overflow list, according to the overflow_policy.
+		 * @param data	The data to write. It's copied into the queue.
+		 * @returns		true when the data was queued; false when it was dropped.
+		 */
+		bool write(std::string_view const& data)
+		{
+			return write(std::string{ data });
+		}
+		/**
+		 * @brief		Queues data to be written to the file, without copying it. This never waits for disk I/O.
+		 * @param data	The data to write.
+		 * @returns		true when the data was queued; false when it was dropped.
+		 */
+		template<std::same_as<std::string> T>
+		bool write(T&& data)
+		{
+			message msg{ std::move(data) };
+			return enqueue(msg, policy);
+		}
+
+		/**
+		 * @brief	Waits until everything that this thread has queued so far has been written to the file.
+		 * @returns	true when everything was written successfully; false when any write has failed.
+		 */
+		bool flush() { return barrier(false); }
+		/**
+		 * @brief	Waits until everything that this thread has queued so far has been written to the file, and the file has been written to the storage device.
+		 * @returns	true when everything was written successfully; false when any write has failed.
+		 */
+		bool sync() { return barrier(true); }
+
+		/// @returns	The overflow policy that's used when the queue is full.
+		overflow_policy get_policy() const noexcept { return policy; }
+		/// @returns	The maximum number of queued writes.
+		size_t capacity() const noexcept { return ring.capacity(); }
+		/// @returns	The number of writes that were dropped because the queue was full.
+		size_t dropped() const noexcept { return droppedCount.load(std::memory_order_relaxed); }
+		/// @returns	true when no write has failed.
+		bool good() const noexcept { return !failed.load(std::memory_order_relaxed); }
+	};
+}
@@ -0,0 +1,340 @@
+/**
+ * @file	buffered_writer.hpp
+ * @author	radj307
+ * @brief	Contains the buffered_writer object, which keeps a file open and batches many small writes into few system calls.
+ */
+#pragma once
+#include <sysarch.h>
+#include <var.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef OS_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else // POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace file {
+	/**
+	 * @class	buffered_writer
+	 * @brief	Keeps a file open for its entire lifetime, and collects written data in a fixed-size buffer that is only written to disk when it's full or flushed.
+	 *\n		This replaces calling file::append() repeatedly, which opens & closes the file for every call.
+	 *\n		When the buffer overflows, its contents & the new data are written together with a single vectored write (writev).
+	 *\n		The buffer is flushed when the writer is destroyed.
+	 * @note	This object isn't thread-safe.
+	 */
+	class buffered_writer {
+	public:
+	#ifdef OS_WIN
+		using native_handle_type = HANDLE;
+	#else
+		using native_handle_type = int;
+	#endif
+
+	private:
+	#ifdef OS_WIN
+		static inline const native_handle_type INVALID_HANDLE{ INVALID_HANDLE_VALUE };
+	#else
+		static constexpr native_handle_type INVALID_HANDLE{ -1 };
+	#endif
+
+		native_handle_type handle{ INVALID_HANDLE };
+		std::vector<char> buffer;
+		size_t used{ 0 };
+		std::chrono::steady_clock::duration flushInterval{ std::chrono::steady_clock::duration::zero() };
+		std::chrono::steady_clock::time_point lastFlush{ std::chrono::steady_clock::now() };
+		std::error_code error;
+
+		void open(std::filesystem::path const& path, bool const append, std::error_code& ec) noexcept
+		{
+			ec.clear();
+		#ifdef OS_WIN
+			// FILE_APPEND_DATA without FILE_WRITE_DATA makes every write go to the current end of the file, like O_APPEND
+			handle = CreateFileW(path.c_str(), append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (handle == INVALID_HANDLE_VALUE)
+				ec.assign(static_cast<int>(GetLastError()), std::system_category());
+		#else
+			// O_APPEND makes every write go to the current end of the file, even when other processes are appending to it too
+			handle = ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC), 0666);
+			if (handle == -1)
+				ec.assign(errno, std::generic_category());
+		#endif
+		}
+
+		/**
+		 * @brief		Writes the given buffers to the file in order, retrying until everything was written.
+		 * @returns		true when everything was written; otherwise false, and error is set.
+		 */
+		bool write_all(std::string_view first, std::string_view second = {}) noexcept
+		{
+			if (handle == INVALID_HANDLE) {
+				error = std::make_error_code(std::errc::bad_file_descriptor);
+				return false;
+			}
+		#ifdef OS_WIN
+			for (std::string_view* part : { &first, &second }) {
+				while (!part->empty()) {
+					DWORD written{ 0 };
+					const DWORD count{ static_cast<DWORD>(std::min<size_t>(part->size(), 0x40000000)) };
+					if (!WriteFile(handle, part->data(), count, &written, nullptr)) {
+						error.assign(static_cast<int>(GetLastError()), std::system_category());
+						return false;
+					}
+					part->remove_prefix(written);
+				}
+			}
+		#else
+			iovec iov[2]{
+				{ const_cast<char*>(first.data()), first.size() },
+				{ const_cast<char*>(second.data()), second.size() },
+			};
+			iovec* next{ iov };
+			int count{ second.empty() ? 1 : 2 };
+			while (count > 0) {
+				const ssize_t written{ ::writev(handle, next, count) };
+				if (written == -1) {
+					if (errno == EINTR)
+						continue;
+					error.assign(errno, std::generic_category());
+					return false;
+				}
+				// skip past whatever was written, which may end partway through a buffer
+				size_t remaining{ static_cast<size_t>(written) };
+				for (; count > 0 && remaining >= next->iov_len; ++next, --count)
+					remaining -= next->iov_len;
+				if (count > 0) {
+					next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+					next->iov_len -= remaining;
+				}
+			}
+		#endif
+			return true;
+		}
+
+		/// @brief	Flushes the buffer when the flush interval has elapsed since the last flush.
+		bool flush_if_due() noexcept
+		{
+			if (flushInterval > std::chrono::steady_clock::duration::zero() && used > 0 && std::chrono::steady_clock::now() - lastFlush >= flushInterval)
+				return flush();
+			return true;
+		}
+
+	public:
+		/// @brief	The default size of the buffer, in bytes; 64 KiB.
+		static constexpr size_t DEFAULT_BUFFER_SIZE{ 64ull * 1024ull };
+
+		/// @brief	Creates a writer that isn't associated with a file.
+		buffered_writer() = default;
+		/**
+		 * @brief				Opens the specified file for writing, creating it if it doesn't exist.
+		 * @param path			The location of the target file.
+		 * @param append		When true, data is appended to the end of the file; otherwise, the file is truncated when it's opened.
+		 * @param bufferSize	The size of the buffer, in bytes.
+		 * @throws std::filesystem::filesystem_error	The file couldn't be opened.
+		 */
+		explicit buffered_writer(std::filesystem::path const& path, bool const append = true, size_t const bufferSize = DEFAULT_BUFFER_SIZE) noexcept(false) :
+			buffer(bufferSize == 0 ? DEFAULT_BUFFER_SIZE : bufferSize)
+		{
+			std::error_code ec;
+			open(path, append, ec);
+			if (ec)
+				throw std::filesystem::filesystem_error("Failed to open file for writing", path, ec);
+		}
+		/**
+		 * @brief				Opens the specified file for writing without throwing exceptions, creating it if it doesn't exist.
+		 * @param path			The location of the target file.
+		 * @param ec			Receives the error that occurred when the file couldn't be opened; is_open() returns false in that case.
+		 * @param append		When true, data is appended to the end of the file; otherwise, the file is truncated when it's opened.
+		 * @param bufferSize	The size of the buffer, in bytes.
+		 */
+		buffered_writer(std::filesystem::path const& path, std::error_code& ec, bool const append = true, size_t const bufferSize = DEFAULT_BUFFER_SIZE) noexcept :
+			buffer(bufferSize == 0 ? DEFAULT_BUFFER_SIZE : bufferSize)
+		{
+			open(path, append, ec);
+		}
+		buffered_writer(buffered_writer const&) = delete;
+		buffered_writer& operator=(buffered_writer const&) = delete;
+		buffered_writer(buffered_writer&& o) noexcept :
+			handle{ std::exchange(o.handle, INVALID_HANDLE) },
+			buffer{ std::move(o.buffer) },
+			used{ std::exchange(o.used, 0) },
+			flushInterval{ o.flushInterval },
+			lastFlush{ o.lastFlush },
+			error{ std::exchange(o.error, {}) }
+		{}
+		buffered_writer& operator=(buffered_writer&& o) noexcept
+		{
+			if (this != &o) {
+				close();
+				handle = std::exchange(o.handle, INVALID_HANDLE);
+				buffer = std::move(o.buffer);
+				used = std::exchange(o.used, 0);
+				flushInterval = o.flushInterval;
+				lastFlush = o.lastFlush;
+				error = std::exchange(o.error, {});
+			}
+			return *this;
+		}
+		/// @brief	Flushes the buffer, then closes the file.
+		~buffered_writer() noexcept { close(); }
+
+		/**
+		 * @brief	Flushes the buffer, then closes the file.
+		 * @returns	true when the buffer was flushed successfully; otherwise false.
+		 */
+		bool close() noexcept
+		{
+			if (handle == INVALID_HANDLE)
+				return true;
+			const bool flushed{ flush() };
+		#ifdef OS_WIN
+			CloseHandle(handle);
+		#else
+			::close(handle);
+		#endif
+			handle = INVALID_HANDLE;
+			return flushed;
+		}
+
+		/// @returns	true when the file is open.
+		bool is_open() const noexcept { return handle != INVALID_HANDLE; }
+		/// @returns	true when the file is open, and no write has failed.
+		bool good() const noexcept { return is_open() && !error; }
+		/// @returns	The error that caused the most recent write to fail, if any.
+		std::error_code const& last_error() const noexcept { return error; }
+		/// @returns	The operating system handle of the file.
+		native_handle_type native_handle() const noexcept { return handle; }
+
+		/// @returns	The size of the buffer, in bytes.
+		size_t capacity() const noexcept { return buffer.size(); }
+		/// @returns	The number of bytes in the buffer that haven't been written to the file yet.
+		size_t pending() const noexcept { return used; }
+
+		/**
+		 * @brief			Sets the maximum amount of time that data may stay in the buffer.
+		 *\n				This is checked when data is written, so the buffer isn't flushed while the writer is idle; call flush() for that.
+		 * @param interval	The maximum amount of time between flushes; when this is zero, data is only written when the buffer is full or flushed.
+		 */
+		template<class Rep, class Period>
+		void set_flush_interval(std::chrono::duration<Rep, Period> const& interval) noexcept
+		{
+			flushInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval);
+		}
+
+		/**
+		 * @brief	Writes the contents of the buffer to the file.
+		 * @returns	true when successful; otherwise false.
+		 */
+		bool flush() noexcept
+		{
+			lastFlush = std::chrono::steady_clock::now();
+			if (used == 0)
+				return true;
+			const bool result{ write_all({ buffer.data(), used }) };
+			used = 0;
+			return result;
+		}
+		/**
+		 * @brief	Flushes the buffer, then waits until the operating system has written the file to the storage device.
+		 * @returns	true when successful; otherwise false.
+		 */
+		bool sync() noexcept
+		{
+			if (!flush())
+				return false;
+		#ifdef OS_WIN
+			if (!FlushFileBuffers(handle)) {
+				error.assign(static_cast<int>(GetLastError()), std::system_category());
+				return false;
+			}
+		#else
+			if (::fsync(handle) == -1) {
+				error.assign(errno, std::generic_category());
+				return false;
+			}
+		#endif
+			return true;
+		}
+
+		/**
+		 * @brief		Writes data to the buffer. If it doesn't fit, the buffer and data are written to the file together.
+		 * @param data	The data to write.
+		 * @returns		true when successful; otherwise false.
+		 */
+		bool write(std::string_view const& data) noexcept
+		{
+			if (handle == INVALID_HANDLE) {
+				error = std::make_error_code(std::errc::bad_file_descriptor);
+				return false;
+			}
+			if (data.size() <= buffer.size() - used) {
+				std::memcpy(buffer.data() + used, data.data(), data.size());
+				used += data.size();
+				return flush_if_due();
+			}
+			lastFlush = std::chrono::steady_clock::now();
+			const bool result{ write_all({ buffer.data(), used }, data) };
+			used = 0;
+			return result;
+		}
+		/**
+		 * @brief		Writes a single character to the buffer.
+		 * @param ch	The character to write.
+		 * @returns		true when successful; otherwise false.
+		 */
+		bool put(char const ch) noexcept
+		{
+			return write({ &ch, 1 });
+		}
+
+		buffered_writer& operator<<(std::string_view const& data) noexcept
+		{
+			write(data);
+			return *this;
+		}
+		buffered_writer& operator<<(char const ch) noexcept
+		{
+			put(ch);
+			return *this;
+		}
+		/// @brief	Writes a number to the buffer, without using a stream.
+		template<class T> requires (std::is_arithmetic_v<T> && !std::same_as<T, char> && !std::same_as<T, bool>)
+		buffered_writer& operator<<(T const& number) noexcept
+		{
+			char digits[64];
+			if (const auto& [end, ec] { std::to_chars(digits, digits + sizeof(digits), number) }; ec == std::errc{})
+				write({ digits, static_cast<size_t>(end - digits) });
+			return *this;
+		}
+		/// @brief	Writes any other streamable object to the buffer by formatting it with a stringstream.
+		template<var::streamable<std::ostringstream> T> requires (!std::is_arithmetic_v<std::remove_cvref_t<T>> && !std::convertible_to<T, std::string_view>)
+		buffered_writer& operator<<(T&& object)
+		{
+			std::ostringstream ss;
+			ss << std::forward<T>(object);
+			write(ss.view());
+			return *this;
+		}
+	};
+}
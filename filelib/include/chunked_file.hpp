@@ -0,0 +1,294 @@
+/**
+ * @file	chunked_file.hpp
+ * @author	radj307
+ * @brief	Contains functions that split large files into byte ranges aligned to line boundaries, and process them concurrently on a thread pool.
+ */
+#pragma once
+#include <sysarch.h>
+#include <make_exception.hpp>
+#include <count_bytes.hpp>
+#include <filei.hpp>
+#include <mapped_file.hpp>
+#include <thread_pool.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace file {
+	/**
+	 * @struct	byte_range
+	 * @brief	A half-open range of byte offsets [begin, end) within a buffer or file.
+	 */
+	struct byte_range {
+		size_t begin{ 0 };
+		size_t end{ 0 };
+
+		/// @returns	The number of bytes in the range.
+		constexpr size_t size() const noexcept { return end - begin; }
+		/// @returns	true when the range doesn't contain any bytes.
+		constexpr bool empty() const noexcept { return begin == end; }
+		/// @returns	The part of buffer covered by this range.
+		constexpr std::string_view in(std::string_view const& buffer) const noexcept { return buffer.substr(begin, size()); }
+
+		constexpr bool operator==(byte_range const&) const noexcept = default;
+	};
+
+	/// @brief	Chunks are never made smaller than this, unless the whole buffer is smaller; splitting tiny buffers costs more than it saves.
+	inline constexpr size_t MIN_CHUNK_SIZE{ 64ull * 1024ull };
+
+	/**
+	 * @brief				Splits a buffer into up to chunkCount contiguous ranges of roughly equal size, each of which ends just after a newline.
+	 *\n					Lines are never split between ranges, so a range may be larger than the others (or some may be merged) when lines are very long.
+	 *\n					The last range ends at the end of the buffer, whether or not it ends with a newline.
+	 * @param buffer		The buffer to split.
+	 * @param chunkCount	The maximum number of ranges to create.
+	 * @param minChunkSize	The minimum size of each range, except when the buffer is smaller than this.
+	 * @returns				The ranges, in order. They cover the entire buffer without overlapping; this is empty when the buffer is empty.
+	 */
+	inline std::vector<byte_range> split_lines(std::string_view const& buffer, size_t chunkCount, size_t const& minChunkSize = MIN_CHUNK_SIZE)
+	{
+		std::vector<byte_range> ranges;
+		if (buffer.empty())
+			return ranges;
+
+		chunkCount = std::clamp<size_t>(buffer.size() / std::max<size_t>(minChunkSize, 1), 1, std::max<size_t>(chunkCount, 1));
+		ranges.reserve(chunkCount);
+
+		size_t begin{ 0 };
+		for (size_t i{ 1 }; i < chunkCount; ++i) {
+			// find the first newline at or after the byte before the ideal boundary, so a boundary that's already aligned is kept
+			const size_t target{ std::max(begin + 1, buffer.size() / chunkCount * i) };
+			if (target >= buffer.size())
+				break;
+			const void* nl{ std::memchr(buffer.data() + target - 1, '\n', buffer.size() - target + 1) };
+			if (nl == nullptr)
+				break;
+			const size_t end{ static_cast<size_t>(static_cast<const char*>(nl) - buffer.data()) + 1 };
+			if (end >= buffer.size())
+				break;
+			ranges.emplace_back(byte_range{ begin, end });
+			begin = end;
+		}
+		ranges.emplace_back(byte_range{ begin, buffer.size() });
+		return ranges;
+	}
+
+	/**
+	 * @class	chunked_file
+	 * @brief	Provides read-only access to the contents of a file, which can be split into ranges aligned to line boundaries.
+	 *\n		Regular files are mapped into memory; files that can't be mapped (pipes, procfs, etc.) are read into a buffer instead.
+	 */
+	class chunked_file {
+		mapped_file map;
+		std::string buffer;
+
+	public:
+		/**
+		 * @brief		Opens the specified file. If it doesn't exist or can't be read, the instance is empty.
+		 * @param path	The location of the target file.
+		 */
+		explicit chunked_file(std::filesystem::path const& path)
+		{
+			std::error_code ec;
+			map = mapped_file{ path, ec, access_hint::WillNeed };
+			if (ec || map.empty())
+				buffer = read_all(path);
+		}
+
+		/// @returns	The contents of the file.
+		std::string_view view() const noexcept { return map.is_mapped() ? map.view() : std::string_view{ buffer }; }
+		/// @returns	The size of the file, in bytes.
+		size_t size() const noexcept { return view().size(); }
+		/// @returns	true when the file is empty.
+		bool empty() const noexcept { return size() == 0; }
+
+		/// @brief	Splits the file into ranges aligned to line boundaries. See file::split_lines().
+		std::vector<byte_range> split(size_t const& chunkCount, size_t const& minChunkSize = MIN_CHUNK_SIZE) const { return split_lines(view(), chunkCount, minChunkSize); }
+		/// @returns	The contents of the file within the given range.
+		std::string_view chunk(byte_range const& range) const noexcept { return range.in(view()); }
+
+		operator std::string_view() const noexcept { return view(); }
+	};
+
+	/**
+	 * @brief				Splits a buffer into ranges aligned to line boundaries, and calls func on each of them concurrently.
+	 * @param buffer		The buffer to process. This must remain valid until the function returns.
+	 * @param func			A callable that accepts (std::string_view chunk, byte_range range), where chunk is the part of buffer within range.
+	 *\n					It's called concurrently from the threads of pool, so it must be safe to call from multiple threads at once.
+	 * @param pool			The thread pool to use.
+	 * @param chunkCount	The maximum number of chunks; when this is 0, the size of the pool is used.
+	 * @returns				When func returns a value, a vector with one result per chunk, in the same order as the chunks appear in the buffer.
+	 * @throws ex::except	Called from a task running on pool; waiting for the chunks there could deadlock the pool.
+	 * @throws ...			Any exception thrown by func is rethrown after all of the chunks have finished; when more than one chunk fails, the exception from the first one is thrown.
+	 */
+	template<class F> requires std::invocable<F&, std::string_view, byte_range>
+	inline auto map_chunks(std::string_view const& buffer, F&& func, shared::thread_pool& pool, size_t chunkCount = 0) noexcept(false)
+	{
+		using result_t = std::invoke_result_t<F&, std::string_view, byte_range>;
+
+		if (pool.is_worker_thread())
+			throw make_exception("map_chunks() cannot be called from a task running on the same thread pool!");
+
+		const auto ranges{ split_lines(buffer, chunkCount == 0 ? pool.size() : chunkCount) };
+
+		std::vector<std::future<result_t>> futures;
+		futures.reserve(ranges.size());
+		for (const auto& range : ranges) {
+			futures.emplace_back(pool.submit([&buffer, &func, range] {
+				return std::invoke(func, range.in(buffer), range);
+			}));
+		}
+
+		// wait for every task before retrieving the results, since they all reference buffer & func
+		for (const auto& future : futures)
+			future.wait();
+
+		if constexpr (std::is_void_v<result_t>) {
+			for (auto& future : futures)
+				future.get();
+		}
+		else {
+			std::vector<result_t> results;
+			results.reserve(futures.size());
+			for (auto& future : futures)
+				results.emplace_back(future.get());
+			return results;
+		}
+	}
+
+	/**
+	 * @brief			Counts the number of times a character appears in a memory buffer, by counting separate chunks of it concurrently.
+	 * @param data		Pointer to the beginning of the buffer.
+	 * @param size		The size of the buffer, in bytes.
+	 * @param character	The character to count.
+	 * @param pool		The thread pool to use.
+	 * @returns			std::streamoff
+	 */
+	inline std::streamoff count(const char* data, const size_t& size, const char& character, shared::thread_pool& pool) noexcept(false)
+	{
+		std::streamoff total{ 0 };
+		for (const auto& count : map_chunks(std::string_view{ data, size }, [character](std::string_view const& chunk, byte_range const&) {
+			return count_bytes(chunk.data(), chunk.size(), character);
+		}, pool))
+			total += static_cast<std::streamoff>(count);
+		return total;
+	}
+	/**
+	 * @brief			Counts the number of times a character appears in a file, by counting separate chunks of it concurrently.
+	 * @param file		The file to search.
+	 * @param character	The character to count.
+	 * @param pool		The thread pool to use.
+	 * @returns			std::streamoff
+	 */
+	inline std::streamoff count(chunked_file const& file, const char& character, shared::thread_pool& pool) noexcept(false)
+	{
+		const auto& view{ file.view() };
+		return count(view.data(), view.size(), character, pool);
+	}
+	/**
+	 * @brief			Counts the number of times a character appears in the specified file, by counting separate chunks of it concurrently.
+	 * @param path		The location of the target file.
+	 * @param character	The character to count.
+	 * @param pool		The thread pool to use.
+	 * @returns			std::streamoff; this is 0 when the file doesn't exist.
+	 */
+	inline std::streamoff count(std::filesystem::path const& path, const char& character, shared::thread_pool& pool) noexcept(false)
+	{
+		return count(chunked_file{ path }, character, pool);
+	}
+	/**
+	 * @brief			Retrieve the number of newline characters in a file, by counting separate chunks of it concurrently.
+	 * @param file		The file to search.
+	 * @param pool		The thread pool to use.
+	 * @returns			std::streamoff
+	 */
+	inline std::streamoff getLineCount(chunked_file const& file, shared::thread_pool& pool) noexcept(false)
+	{
+		return count(file, '\n', pool);
+	}
+	/**
+	 * @brief			Retrieve the number of newline characters in the specified file, by counting separate chunks of it concurrently.
+	 * @param path		The location of the target file.
+	 * @param pool		The thread pool to use.
+	 * @returns			std::streamoff; this is 0 when the file doesn't exist.
+	 */
+	inline std::streamoff getLineCount(std::filesystem::path const& path, shared::thread_pool& pool) noexcept(false)
+	{
+		return count(path, '\n', pool);
+	}
+
+	/**
+	 * @brief			Finds every occurrence of needle in a memory buffer, by searching separate chunks of it concurrently.
+	 *\n				Occurrences that cross the boundary between two chunks are found as well.
+	 * @param data		Pointer to the beginning of the buffer.
+	 * @param size		The size of the buffer, in bytes.
+	 * @param needle	The string to search for. When this is empty, nothing is found.
+	 * @param pool		The thread pool to use.
+	 * @returns			The byte offset of each occurrence in the buffer, in ascending order. Occurrences may overlap.
+	 */
+	inline std::vector<size_t> find_all(const char* data, const size_t& size, std::string_view const& needle, shared::thread_pool& pool) noexcept(false)
+	{
+		if (needle.empty())
+			return{};
+
+		const std::string_view buffer{ data, size };
+		auto found{ map_chunks(buffer, [&buffer, &needle](std::string_view const&, byte_range const& range) {
+			// an occurrence belongs to the chunk it starts in, so search past the end of the chunk by up to needle.size() - 1 bytes
+			const std::string_view area{ buffer.substr(range.begin, range.size() + needle.size() - 1) };
+			const std::boyer_moore_horspool_searcher searcher{ needle.begin(), needle.end() };
+
+			std::vector<size_t> offsets;
+			for (auto it{ area.begin() }; ; ++it) {
+				it = std::search(it, area.end(), searcher);
+				if (it == area.end())
+					break;
+				offsets.emplace_back(range.begin + static_cast<size_t>(it - area.begin()));
+			}
+			return offsets;
+		}, pool) };
+
+		std::vector<size_t> offsets;
+		if (found.size() == 1)
+			offsets = std::move(found.front());
+		else {
+			size_t total{ 0 };
+			for (const auto& it : found)
+				total += it.size();
+			offsets.reserve(total);
+			for (const auto& it : found)
+				offsets.insert(offsets.end(), it.begin(), it.end());
+		}
+		return offsets;
+	}
+	/**
+	 * @brief			Finds every occurrence of needle in a file, by searching separate chunks of it concurrently.
+	 * @param file		The file to search.
+	 * @param needle	The string to search for. When this is empty, nothing is found.
+	 * @param pool		The thread pool to use.
+	 * @returns			The byte offset of each occurrence in the file, in ascending order. Occurrences may overlap.
+	 */
+	inline std::vector<size_t> find_all(chunked_file const& file, std::string_view const& needle, shared::thread_pool& pool) noexcept(false)
+	{
+		const auto& view{ file.view() };
+		return find_all(view.data(), view.size(), needle, pool);
+	}
+	/**
+	 * @brief			Finds every occurrence of needle in the specified file, by searching separate chunks of it concurrently.
+	 * @param path		The location of the target file.
+	 * @param needle	The string to search for. When this is empty, nothing is found.
+	 * @param pool		The thread pool to use.
+	 * @returns			The byte offset of each occurrence in the file, in ascending order. Occurrences may overlap.
+	 */
+	inline std::vector<size_t> find_all(std::filesystem::path const& path, std::string_view const& needle, shared::thread_pool& pool) noexcept(false)
+	{
+		return find_all(chunked_file{ path }, needle, pool);
+	}
+}
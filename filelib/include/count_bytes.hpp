@@ -0,0 +1,140 @@
+/**
+ * @file	count_bytes.hpp
+ * @author	radj307
+ * @brief	Contains the count_bytes() function, which counts the occurrences of a byte in a buffer using SSE2/AVX2 when they're available.
+ */
+#pragma once
+#include <sysarch.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FILELIB_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(FILELIB_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FILELIB_SSE2
+#endif
+#if defined(FILELIB_X86) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define FILELIB_AVX2
+#endif
+
+#if defined(FILELIB_AVX2) && (defined(__GNUC__) || defined(__clang__))
+#define FILELIB_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FILELIB_TARGET_AVX2
+#endif
+
+namespace file {
+	namespace _internal {
+		/// @brief	Counts the occurrences of ch in [data, data + size) one byte at a time.
+		inline size_t count_bytes_scalar(const char* data, size_t size, char const ch) noexcept
+		{
+			size_t count{ 0 };
+			for (const char* const end{ data + size }; data != end; ++data)
+				count += (*data == ch);
+			return count;
+		}
+
+	#ifdef FILELIB_SSE2
+		/**
+		 * @brief	Counts the occurrences of ch in [data, data + size) 16 bytes at a time.
+		 *\n		Matches are accumulated in 8-bit lanes, which are summed into 64-bit totals before they can overflow.
+		 */
+		inline size_t count_bytes_sse2(const char* data, size_t size, char const ch) noexcept
+		{
+			const __m128i needle{ _mm_set1_epi8(ch) };
+			const __m128i zero{ _mm_setzero_si128() };
+			__m128i totals{ zero };
+
+			while (size >= 16) {
+				__m128i lanes{ zero };
+				// each lane is incremented at most once per iteration, so 255 iterations can't overflow it
+				for (size_t i{ 0 }; i < 255 && size >= 16; ++i, data += 16, size -= 16)
+					lanes = _mm_sub_epi8(lanes, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), needle));
+				totals = _mm_add_epi64(totals, _mm_sad_epu8(lanes, zero));
+			}
+
+			alignas(16) uint64_t sums[2];
+			_mm_store_si128(reinterpret_cast<__m128i*>(sums), totals);
+			return static_cast<size_t>(sums[0] + sums[1]) + count_bytes_scalar(data, size, ch);
+		}
+	#endif
+
+	#ifdef FILELIB_AVX2
+		/// @brief	Counts the occurrences of ch in [data, data + size) 32 bytes at a time. The CPU must support AVX2.
+		FILELIB_TARGET_AVX2 inline size_t count_bytes_avx2(const char* data, size_t size, char const ch) noexcept
+		{
+			const __m256i needle{ _mm256_set1_epi8(ch) };
+			const __m256i zero{ _mm256_setzero_si256() };
+			__m256i totals{ zero };
+
+			while (size >= 32) {
+				__m256i lanes{ zero };
+				for (size_t i{ 0 }; i < 255 && size >= 32; ++i, data += 32, size -= 32)
+					lanes = _mm256_sub_epi8(lanes, _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), needle));
+				totals = _mm256_add_epi64(totals, _mm256_sad_epu8(lanes, zero));
+			}
+
+			alignas(32) uint64_t sums[4];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(sums), totals);
+			return static_cast<size_t>(sums[0] + sums[1] + sums[2] + sums[3]) + count_bytes_scalar(data, size, ch);
+		}
+
+		/// @returns	true when both the CPU and the operating system support AVX2.
+		inline bool has_avx2() noexcept
+		{
+		#ifdef _MSC_VER
+			int info[4]{};
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+			__cpuid(info, 1);
+			// the OS must save the YMM registers on context switches
+			if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+				return false;
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+		#else
+			return __builtin_cpu_supports("avx2");
+		#endif
+		}
+	#endif
+
+		using count_bytes_fn = size_t(*)(const char*, size_t, char) noexcept;
+
+		/// @returns	The fastest implementation of count_bytes that's supported by the current CPU.
+		inline count_bytes_fn select_count_bytes() noexcept
+		{
+		#ifdef FILELIB_AVX2
+			if (has_avx2())
+				return &count_bytes_avx2;
+		#endif
+		#ifdef FILELIB_SSE2
+			return &count_bytes_sse2;
+		#else
+			return &count_bytes_scalar;
+		#endif
+		}
+	}
+
+	/**
+	 * @brief		Counts the number of times a byte appears in the given buffer.
+	 *\n			The implementation is selected the first time this is called; AVX2 is used when the CPU supports it,
+	 *\n			 then SSE2, and finally a portable scalar loop.
+	 * @param data	Pointer to the beginning of the buffer.
+	 * @param size	The size of the buffer, in bytes.
+	 * @param ch	The byte to count.
+	 * @returns		The number of occurrences of ch.
+	 */
+	inline size_t count_bytes(const char* data, size_t size, char const ch) noexcept
+	{
+		static const _internal::count_bytes_fn impl{ _internal::select_count_bytes() };
+		return impl(data, size, ch);
+	}
+}
@@ -0,0 +1,497 @@
+/**
+ * @file	directory_walker.hpp
+ * @author	radj307
+ * @brief	Contains functions that recursively walk directory trees, applying filters during traversal, either in parallel or as a lazy range.
+ */
+#pragma once
+#include <sysarch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace file {
+	/**
+	 * @struct	walk_options
+	 * @brief	Determines which directories are entered & which entries are reported when walking a directory tree.
+	 *\n		Filters are checked from cheapest to most expensive; the size & modification time filters are only checked when they're set,
+	 *\n		 since they may require an extra system call for each entry.
+	 */
+	struct walk_options {
+		/// @brief	When not empty, only entries with one of these extensions are reported. Extensions must include the '.' prefix.
+		std::vector<std::filesystem::path> extensions;
+		/// @brief	When not empty, only entries whose filename matches at least one of these patterns are reported. '*' matches any number of characters, and '?' matches exactly one.
+		std::vector<std::filesystem::path> globs;
+		/// @brief	When true, extensions & globs are compared without regard to the case of ASCII letters.
+		bool ignoreCase{ false };
+
+		/// @brief	When set, only entries that are at least this many bytes are reported.
+		std::optional<std::uintmax_t> minSize;
+		/// @brief	When set, only entries that are at most this many bytes are reported.
+		std::optional<std::uintmax_t> maxSize;
+		/// @brief	When set, only entries that were modified at or after this time are reported.
+		std::optional<std::filesystem::file_time_type> modifiedAfter;
+		/// @brief	When set, only entries that were modified before this time are reported.
+		std::optional<std::filesystem::file_time_type> modifiedBefore;
+
+		/// @brief	When true, directories are reported as well as files; the filters above apply to them too.
+		bool includeDirectories{ false };
+		/// @brief	When true, symbolic links to directories are entered. This may visit the same directory more than once.
+		bool followSymlinks{ false };
+		/// @brief	The maximum depth to descend to; entries in the root directory have a depth of 0. When not set, there is no limit.
+		std::optional<size_t> maxDepth;
+		/// @brief	When set, directories are only entered when this returns true. It's called concurrently during a parallel walk.
+		std::function<bool(std::filesystem::directory_entry const&)> directoryFilter;
+
+	private:
+		using char_t = std::filesystem::path::value_type;
+		using view_t = std::basic_string_view<char_t>;
+
+		static constexpr char_t fold(char_t const ch, bool const ignoreCase) noexcept
+		{
+			return (ignoreCase && ch >= 'A' && ch <= 'Z') ? static_cast<char_t>(ch + ('a' - 'A')) : ch;
+		}
+
+		static bool equals(view_t const& left, view_t const& right, bool const ignoreCase) noexcept
+		{
+			return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(), [ignoreCase](char_t const l, char_t const r) { return fold(l, ignoreCase) == fold(r, ignoreCase); });
+		}
+
+		/// @returns	true when name matches the wildcard pattern. This is linear in practice, since it only backtracks to the most recent '*'.
+		static bool glob_match(view_t const& pattern, view_t const& name, bool const ignoreCase) noexcept
+		{
+			size_t p{ 0 }, n{ 0 }, star{ view_t::npos }, resume{ 0 };
+			while (n < name.size()) {
+				if (p < pattern.size() && (pattern[p] == '?' || fold(pattern[p], ignoreCase) == fold(name[n], ignoreCase))) {
+					++p;
+					++n;
+				}
+				else if (p < pattern.size() && pattern[p] == '*') {
+					star = p++;
+					resume = n;
+				}
+				else if (star != view_t::npos) {
+					p = star + 1;
+					n = ++resume;
+				}
+				else return false;
+			}
+			while (p < pattern.size() && pattern[p] == '*')
+				++p;
+			return p == pattern.size();
+		}
+
+		/// @returns	The filename component of a native path string, without allocating.
+		static view_t filename_of(view_t const& path) noexcept
+		{
+		#ifdef OS_WIN
+			const auto& pos{ path.find_last_of(L"\\/") };
+		#else
+			const auto& pos{ path.rfind('/') };
+		#endif
+			return pos == view_t::npos ? path : path.substr(pos + 1);
+		}
+
+	public:
+		/// @returns	true when the filename of the given entry passes the extension & glob filters.
+		bool matches_name(std::filesystem::directory_entry const& entry) const noexcept
+		{
+			if (extensions.empty() && globs.empty())
+				return true;
+			const view_t& name{ filename_of(entry.path().native()) };
+
+			if (!extensions.empty()) {
+				// the same rules as path::extension(); filenames that only start with a '.' don't have an extension
+				const auto& dot{ name.rfind('.') };
+				if (dot == view_t::npos || dot == 0)
+					return false;
+				const view_t& ext{ name.substr(dot) };
+				if (std::none_of(extensions.begin(), extensions.end(), [&](std::filesystem::path const& it) { return equals(it.native(), ext, ignoreCase); }))
+					return false;
+			}
+			return globs.empty() || std::any_of(globs.begin(), globs.end(), [&](std::filesystem::path const& it) { return glob_match(it.native(), name, ignoreCase); });
+		}
+		/// @returns	true when the given entry passes the size & modification time filters.
+		bool matches_attributes(std::filesystem::directory_entry const& entry) const noexcept
+		{
+			std::error_code ec;
+			if (minSize.has_value() || maxSize.has_value()) {
+				const auto& size{ entry.file_size(ec) };
+				if (ec || (minSize.has_value() && size < *minSize) || (maxSize.has_value() && size > *maxSize))
+					return false;
+			}
+			if (modifiedAfter.has_value() || modifiedBefore.has_value()) {
+				const auto& time{ entry.last_write_time(ec) };
+				if (ec || (modifiedAfter.has_value() && time < *modifiedAfter) || (modifiedBefore.has_value() && time >= *modifiedBefore))
+					return false;
+			}
+			return true;
+		}
+		/// @returns	true when the given entry passes all of the filters, and should be reported.
+		bool matches(std::filesystem::directory_entry const& entry) const noexcept
+		{
+			return matches_name(entry) && matches_attributes(entry);
+		}
+		/**
+		 * @brief			Checks whether a subdirectory should be entered.
+		 * @param entry		The subdirectory.
+		 * @param depth		The depth of the entries inside the subdirectory.
+		 * @returns			true when the subdirectory should be entered.
+		 */
+		bool should_enter(std::filesystem::directory_entry const& entry, size_t const depth) const
+		{
+			std::error_code ec;
+			return (!maxDepth.has_value() || depth <= *maxDepth)
+				&& (followSymlinks || !entry.is_symlink(ec))
+				&& (!directoryFilter || directoryFilter(entry));
+		}
+	};
+
+	/**
+	 * @struct	walk_result
+	 * @brief	Statistics about a completed walk.
+	 */
+	struct walk_result {
+		/// @brief	The number of entries that were reported.
+		size_t matched{ 0 };
+		/// @brief	The number of directories that were read, including the root.
+		size_t directories{ 0 };
+		/// @brief	The number of directories that couldn't be read, which were skipped.
+		size_t errors{ 0 };
+		/// @brief	true when the callback stopped the walk early.
+		bool stopped{ false };
+	};
+
+	namespace _internal {
+		/**
+		 * @class	walk_state
+		 * @brief	The state shared between the threads of a parallel walk.
+		 *\n		Each thread owns a deque of directories to read; it pushes & pops at the back of its own deque, and when it runs out,
+		 *\n		 it steals from the front of the other threads' deques. Stolen directories are the oldest, which are closest to the root,
+		 *\n		 so they tend to contain the most remaining work.
+		 */
+		template<class F>
+		class walk_state {
+			struct work_item {
+				std::filesystem::path path;
+				size_t depth;
+			};
+			struct alignas(64) worker_queue {
+				std::mutex mutex;
+				std::deque<work_item> items;
+			};
+
+			walk_options const& options;
+			F& callback;
+			std::vector<worker_queue> queues;
+			/// @brief	The number of directories that are queued or being read; the walk is finished when this reaches 0.
+			std::atomic<size_t> pending{ 0 };
+			/// @brief	Incremented whenever a directory is queued, so idle threads can wait for it to change.
+			std::atomic<uint32_t> version{ 0 };
+			std::atomic<size_t> idle{ 0 };
+			std::atomic<bool> stop{ false };
+
+			std::atomic<size_t> matched{ 0 }, directories{ 0 }, errors{ 0 };
+			std::mutex exceptionMutex;
+			std::exception_ptr exception;
+
+			void push(size_t const self, work_item&& item)
+			{
+				pending.fetch_add(1, std::memory_order_relaxed);
+				{
+					std::scoped_lock<std::mutex> lock(queues[self].mutex);
+					queues[self].items.emplace_back(std::move(item));
+				}
+				version.fetch_add(1);
+				if (idle.load() != 0)
+					version.notify_all();
+			}
+
+			bool try_pop(size_t const self, work_item& out)
+			{
+				{
+					auto& own{ queues[self] };
+					std::scoped_lock<std::mutex> lock(own.mutex);
+					if (!own.items.empty()) {
+						out = std::move(own.items.back());
+						own.items.pop_back();
+						return true;
+					}
+				}
+				for (size_t i{ 1 }; i < queues.size(); ++i) {
+					auto& victim{ queues[(self + i) % queues.size()] };
+					std::scoped_lock<std::mutex> lock(victim.mutex);
+					if (!victim.items.empty()) {
+						out = std::move(victim.items.front());
+						victim.items.pop_front();
+						return true;
+					}
+				}
+				return false;
+			}
+
+			/// @returns	false when the callback asked to stop the walk.
+			bool report(std::filesystem::directory_entry const& entry)
+			{
+				matched.fetch_add(1, std::memory_order_relaxed);
+				if constexpr (std::is_convertible_v<std::invoke_result_t<F&, std::filesystem::directory_entry const&>, bool>)
+					return static_cast<bool>(std::invoke(callback, entry));
+				else {
+					std::invoke(callback, entry);
+					return true;
+				}
+			}
+
+			void read_directory(size_t const self, work_item const& item)
+			{
+				std::error_code ec;
+				std::filesystem::directory_iterator it{ item.path, std::filesystem::directory_options::skip_permission_denied, ec };
+				if (ec) {
+					errors.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				directories.fetch_add(1, std::memory_order_relaxed);
+
+				for (const std::filesystem::directory_iterator end; it != end; it.increment(ec)) {
+					if (ec || stop.load(std::memory_order_relaxed))
+						break;
+					const auto& entry{ *it };
+					std::error_code typeError;
+					// directory_entry caches the file type from the directory listing, so this usually doesn't need a system call
+					if (entry.is_directory(typeError)) {
+						if (options.should_enter(entry, item.depth + 1))
+							push(self, { entry.path(), item.depth + 1 });
+						if (!options.includeDirectories)
+							continue;
+					}
+					if (options.matches(entry) && !report(entry)) {
+						stop.store(true, std::memory_order_relaxed);
+						break;
+					}
+				}
+				if (ec)
+					errors.fetch_add(1, std::memory_order_relaxed);
+			}
+
+		public:
+			walk_state(walk_options const& options, F& callback, size_t const threadCount) : options{ options }, callback{ callback }, queues(threadCount) {}
+
+			void run(std::filesystem::path const& root)
+			{
+				push(0, { root, 0 });
+
+				std::vector<std::thread> threads;
+				threads.reserve(queues.size() - 1);
+				try {
+					for (size_t i{ 1 }; i < queues.size(); ++i)
+						threads.emplace_back(&walk_state::worker_main, this, i);
+				} catch (...) {
+					// the threads that did start steal from each other, so the walk still finishes, just with less parallelism
+				}
+				worker_main(0);
+				for (auto& thread : threads)
+					thread.join();
+
+				if (exception)
+					std::rethrow_exception(exception);
+			}
+
+			void worker_main(size_t const self)
+			{
+				work_item item;
+				while (true) {
+					const auto& lastVersion{ version.load() };
+					if (try_pop(self, item)) {
+						if (!stop.load(std::memory_order_relaxed)) {
+							try {
+								read_directory(self, item);
+							} catch (...) {
+								std::scoped_lock<std::mutex> lock(exceptionMutex);
+								if (!exception)
+									exception = std::current_exception();
+								stop.store(true);
+							}
+						}
+						if (pending.fetch_sub(1) == 1) {
+							// that was the last directory; wake up the idle threads so they can exit
+							version.fetch_add(1);
+							version.notify_all();
+							return;
+						}
+						continue;
+					}
+					if (pending.load() == 0)
+						return;
+					idle.fetch_add(1);
+					version.wait(lastVersion);
+					idle.fetch_sub(1);
+				}
+			}
+
+			walk_result result() const noexcept
+			{
+				return{ matched.load(), directories.load(), errors.load(), stop.load() && !exception };
+			}
+		};
+	}
+
+	/**
+	 * @brief				Recursively walks a directory tree in parallel, and calls a function for each entry that passes the filters.
+	 *\n					Subdirectories are read concurrently by a set of threads that steal work from each other, so wide & deep trees are both spread evenly.
+	 *\n					Nothing is collected; entries are passed to the callback as soon as they're found.
+	 * @param root			The directory to walk.
+	 * @param callback		A callable that accepts a std::filesystem::directory_entry const&. It's called concurrently from multiple threads, in no particular order.
+	 *\n					When it returns a value that's convertible to bool, returning false stops the walk as soon as possible.
+	 * @param options		The filters to apply.
+	 * @param threadCount	The number of threads to use, including the calling thread. When this is 0, the number of hardware threads is used.
+	 * @returns				Statistics about the walk.
+	 * @throws ...			Any exception thrown by callback or the directory filter is rethrown once all of the threads have stopped.
+	 */
+	template<class F> requires std::invocable<F&, std::filesystem::directory_entry const&>
+	inline walk_result walk(std::filesystem::path const& root, F&& callback, walk_options const& options = {}, size_t threadCount = 0) noexcept(false)
+	{
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		_internal::walk_state<std::remove_reference_t<F>> state{ options, callback, threadCount };
+		state.run(root);
+		return state.result();
+	}
+
+	/**
+	 * @class	directory_walk_range
+	 * @brief	A lazy, single-threaded range over the entries of a directory tree that pass the given filters.
+	 *\n		Entries are read from the filesystem as the range is iterated, so nothing is collected in advance.
+	 *\n		Directories that are excluded by maxDepth, followSymlinks, or the directoryFilter are not entered at all.
+	 *\n		Like walk(), directories that can't be read are skipped & counted by errors(), and the rest of the tree is still visited.
+	 *
+	 *			Usage:
+	 *			```cpp
+	 *			for (auto const& entry : file::directory_walk_range{ "logs", { .extensions{ ".log" } } }) { ... }
+	 *			```
+	 */
+	class directory_walk_range {
+		/// @brief	The directories being read, from the root to the current one; the depth of the current entry is stack.size() - 1.
+		std::vector<std::filesystem::directory_iterator> stack;
+		walk_options options;
+		/// @brief	true when the current entry is a directory that should be entered when advancing.
+		bool enterPending{ false };
+		size_t errorCount{ 0 };
+
+		/// @returns	true when the directory was opened & contains at least one entry, making it the current directory.
+		bool open(std::filesystem::path const& path)
+		{
+			std::error_code ec;
+			std::filesystem::directory_iterator it{ path, std::filesystem::directory_options::skip_permission_denied, ec };
+			if (ec) {
+				++errorCount;
+				return false;
+			}
+			if (it == std::filesystem::directory_iterator{})
+				return false;
+			stack.emplace_back(std::move(it));
+			return true;
+		}
+
+		/// @brief	Moves to the next entry in the tree, entering the current entry first when it's a directory that passed should_enter().
+		void advance()
+		{
+			if (std::exchange(enterPending, false)) {
+				const auto path{ stack.back()->path() };
+				if (open(path))
+					return;
+			}
+			while (!stack.empty()) {
+				std::error_code ec;
+				stack.back().increment(ec);
+				if (ec)
+					++errorCount; //< the rest of this directory is skipped, like walk() does
+				else if (stack.back() != std::filesystem::directory_iterator{})
+					return;
+				stack.pop_back();
+			}
+		}
+
+		/// @brief	Skips entries that don't pass the filters, and marks the directories that should be entered.
+		void settle()
+		{
+			while (!stack.empty()) {
+				const auto& entry{ *stack.back() };
+				std::error_code typeError;
+				if (entry.is_directory(typeError)) {
+					enterPending = options.should_enter(entry, stack.size());
+					if (!options.includeDirectories) {
+						advance();
+						continue;
+					}
+				}
+				if (options.matches(entry))
+					return;
+				advance();
+			}
+		}
+
+	public:
+		/**
+		 * @brief			Opens the given directory. If it can't be read, the range is empty.
+		 * @param root		The directory to walk.
+		 * @param options	The filters to apply.
+		 */
+		directory_walk_range(std::filesystem::path const& root, walk_options options = {}) : options{ std::move(options) }
+		{
+			if (open(root))
+				settle();
+		}
+
+		/// @returns	The number of directories that couldn't be read so far, which were skipped.
+		size_t errors() const noexcept { return errorCount; }
+
+		/**
+		 * @class	iterator
+		 * @brief	Input iterator over the entries of a directory_walk_range.
+		 */
+		class iterator {
+			directory_walk_range* range{ nullptr };
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::filesystem::directory_entry;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const std::filesystem::directory_entry*;
+			using reference = const std::filesystem::directory_entry&;
+
+			iterator() = default;
+			explicit iterator(directory_walk_range* range) : range{ range } {}
+
+			reference operator*() const { return *range->stack.back(); }
+			pointer operator->() const { return &*range->stack.back(); }
+
+			iterator& operator++()
+			{
+				range->advance();
+				range->settle();
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+			bool operator==(std::default_sentinel_t) const noexcept { return range == nullptr || range->stack.empty(); }
+		};
+
+		/// @returns	An iterator to the next entry. The range can only be iterated once.
+		iterator begin() { return iterator{ this }; }
+		/// @returns	The end-of-range sentinel.
+		std::default_sentinel_t end() const noexcept { return{}; }
+	};
+}
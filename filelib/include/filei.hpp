@@ -4,10 +4,38 @@
  * @brief	Contains file input functions.
  */
 #pragma once
+#include <sysarch.h>
 #include "openmode.h"
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 #include <filesystem>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#ifdef OS_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else // POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #ifdef read
 #undef read
@@ -43,4 +71,285 @@ namespace file {
 			buffer << ifs.rdbuf();
 		return std::move(buffer);
 	}
+
+	#pragma region BinaryRead
+	namespace _internal {
+		/**
+		 * @class	read_handle
+		 * @brief	Owns a file that's open for reading from beginning to end, and closes it when the object is destroyed.
+		 */
+		class read_handle {
+		#ifdef OS_WIN
+			HANDLE handle{ INVALID_HANDLE_VALUE };
+		#else
+			int fd{ -1 };
+		#endif
+			size_t _size{ 0 };
+			bool _sized{ false };
+
+		public:
+			/**
+			 * @brief		Opens the specified file for reading.
+			 * @param path	The location of the target file.
+			 * @param ec	Receives the error that occurred, if any.
+			 */
+			read_handle(std::filesystem::path const& path, std::error_code& ec) noexcept
+			{
+				ec.clear();
+			#ifdef OS_WIN
+				handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (handle == INVALID_HANDLE_VALUE) {
+					ec.assign(static_cast<int>(GetLastError()), std::system_category());
+					return;
+				}
+				if (LARGE_INTEGER size{}; GetFileType(handle) == FILE_TYPE_DISK && GetFileSizeEx(handle, &size) && size.QuadPart > 0) {
+					if (static_cast<unsigned long long>(size.QuadPart) > (std::numeric_limits<size_t>::max)()) {
+						ec = std::make_error_code(std::errc::value_too_large);
+						return;
+					}
+					_size = static_cast<size_t>(size.QuadPart);
+					_sized = true;
+				}
+			#else
+				fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				if (fd == -1) {
+					ec.assign(errno, std::generic_category());
+					return;
+				}
+				struct stat st {};
+				if (fstat(fd, &st) == -1) {
+					ec.assign(errno, std::generic_category());
+					return;
+				}
+				if (S_ISDIR(st.st_mode)) {
+					ec = std::make_error_code(std::errc::is_a_directory);
+					return;
+				}
+				// special files (pipes, devices) don't report a meaningful size, and procfs reports 0, so they're read until the end instead
+				if (S_ISREG(st.st_mode) && st.st_size > 0) {
+					if (static_cast<unsigned long long>(st.st_size) > (std::numeric_limits<size_t>::max)()) {
+						ec = std::make_error_code(std::errc::value_too_large);
+						return;
+					}
+					_size = static_cast<size_t>(st.st_size);
+					_sized = true;
+				}
+			#ifdef POSIX_FADV_SEQUENTIAL
+				(void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+			#endif
+			#endif
+			}
+			read_handle(read_handle const&) = delete;
+			read_handle& operator=(read_handle const&) = delete;
+			~read_handle() noexcept
+			{
+			#ifdef OS_WIN
+				if (handle != INVALID_HANDLE_VALUE)
+					CloseHandle(handle);
+			#else
+				if (fd != -1)
+					::close(fd);
+			#endif
+			}
+
+			/// @returns	true when the file reports a size other than 0; special files (pipes, devices, procfs) don't, and neither do empty files.
+			bool has_size() const noexcept { return _sized; }
+			/// @returns	The size of the file when it was opened, in bytes. This is 0 when has_size() is false.
+			size_t size() const noexcept { return _size; }
+
+			/**
+			 * @brief		Reads from the current position until count bytes have been read, or the end of the file is reached.
+			 * @param dest	The buffer to read into, which must be at least count bytes long.
+			 * @param count	The maximum number of bytes to read.
+			 * @param ec	Receives the error that occurred, if any.
+			 * @returns		The number of bytes that were read; when this is less than count and ec isn't set, the end of the file was reached.
+			 */
+			size_t read(void* dest, size_t const& count, std::error_code& ec) noexcept
+			{
+				auto* const out{ static_cast<char*>(dest) };
+				size_t total{ 0 };
+				while (total < count) {
+				#ifdef OS_WIN
+					DWORD n{ 0 };
+					if (!ReadFile(handle, out + total, static_cast<DWORD>(std::min<size_t>(count - total, 0x40000000)), &n, nullptr)) {
+						// the write end of a pipe was closed
+						if (const auto& error{ GetLastError() }; error != ERROR_BROKEN_PIPE)
+							ec.assign(static_cast<int>(error), std::system_category());
+						break;
+					}
+				#else
+					const ssize_t n{ ::read(fd, out + total, count - total) };
+					if (n == -1) {
+						if (errno == EINTR)
+							continue;
+						ec.assign(errno, std::generic_category());
+						break;
+					}
+				#endif
+					if (n == 0)
+						break;
+					total += static_cast<size_t>(n);
+				}
+				return total;
+			}
+		};
+	}
+
+	/**
+	 * @concept	byte_buffer
+	 * @brief	Requires type T to be a resizable, contiguous container of single-byte elements; for example std::vector<std::byte> or std::string.
+	 */
+	template<class T> concept byte_buffer = std::ranges::contiguous_range<T>
+		&& sizeof(std::ranges::range_value_t<T>) == 1
+		&& std::is_trivially_copyable_v<std::ranges::range_value_t<T>>
+		&& requires(T& buffer, size_t size) { buffer.resize(size); };
+
+	namespace _internal {
+		/**
+		 * @brief			Reads the rest of an open file into a buffer, replacing its contents & resizing it to fit.
+		 *\n				Regular files are read with a single read call, using the size of the file when it was opened, followed by
+		 *\n				 a 1-byte read that confirms the end was reached. Files that grew since they were opened, and special files
+		 *\n				 that don't report a size, are read until the end in increasingly large blocks.
+		 * @param file		The file to read.
+		 * @param buffer	The buffer to read into. If an error occurs, this contains whatever was read before it occurred.
+		 * @param ec		Receives the error that occurred, if any.
+		 */
+		template<byte_buffer TBuffer>
+		inline void read_to_end(read_handle& file, TBuffer& buffer, std::error_code& ec) noexcept(false)
+		{
+			size_t used{ 0 };
+			if (file.has_size()) {
+				buffer.resize(file.size());
+				used = file.read(std::ranges::data(buffer), file.size(), ec);
+				// probe for more data without enlarging the buffer, so its storage is still reused when the file didn't grow
+				std::byte next{};
+				if (ec || used < file.size() || file.read(&next, 1, ec) == 0) {
+					buffer.resize(used);
+					return;
+				}
+				buffer.resize(used + 1);
+				std::memcpy(std::ranges::data(buffer) + used++, &next, 1);
+			}
+			for (size_t size{ (std::max)(used * 2, size_t{ 64 * 1024 }) }; ; size *= 2) {
+				buffer.resize(size);
+				used += file.read(std::ranges::data(buffer) + used, size - used, ec);
+				if (ec || used < size)
+					break;
+			}
+			buffer.resize(used);
+		}
+	}
+
+	/**
+	 * @brief			Reads the contents of a file into a caller-owned buffer of fixed size, without allocating any memory.
+	 * @param path		The location of the target file.
+	 * @param buffer	The buffer to read into.
+	 * @param ec		Receives the error that occurred, if any. When the file is larger than buffer, this is set to errc::value_too_large
+	 *\n				and buffer contains as much of the beginning of the file as fits in it.
+	 * @returns			The number of bytes that were read into buffer.
+	 */
+	inline size_t read_into(std::filesystem::path const& path, std::span<std::byte> const& buffer, std::error_code& ec) noexcept
+	{
+		_internal::read_handle file{ path, ec };
+		if (ec)
+			return 0;
+
+		const size_t count{ file.read(buffer.data(), buffer.size(), ec) };
+		if (!ec && count == buffer.size()) {
+			if (file.size() > buffer.size())
+				ec = std::make_error_code(std::errc::value_too_large);
+			// special files don't report a size, so check whether anything is left
+			else if (std::byte next{}; !file.has_size() && file.read(&next, 1, ec) != 0)
+				ec = std::make_error_code(std::errc::value_too_large);
+		}
+		return count;
+	}
+	/**
+	 * @brief			Reads the contents of a file into a caller-owned buffer of fixed size, without allocating any memory.
+	 * @param path		The location of the target file.
+	 * @param buffer	The buffer to read into.
+	 * @returns			The number of bytes that were read into buffer.
+	 * @throws std::filesystem::filesystem_error	The file couldn't be read, or it's larger than buffer.
+	 */
+	inline size_t read_into(std::filesystem::path const& path, std::span<std::byte> const& buffer) noexcept(false)
+	{
+		std::error_code ec;
+		const size_t count{ read_into(path, buffer, ec) };
+		if (ec)
+			throw std::filesystem::filesystem_error("Failed to read file", path, ec);
+		return count;
+	}
+	/**
+	 * @brief			Reads the contents of a file into a caller-owned buffer, replacing its contents & resizing it to fit the file.
+	 *\n				Regular files are read with a single read call, using the size of the file when it was opened; if the file grew since then, the rest is read too.
+	 *\n				The buffer's storage is reused, so repeatedly loading files into the same buffer only allocates when a file is larger than any before it.
+	 * @param path		The location of the target file.
+	 * @param buffer	The buffer to read into. If an error occurs, this contains whatever was read before it occurred.
+	 * @param ec		Receives the error that occurred, if any.
+	 */
+	template<byte_buffer TBuffer>
+	inline void read_into(std::filesystem::path const& path, TBuffer& buffer, std::error_code& ec) noexcept(false)
+	{
+		buffer.resize(0);
+		_internal::read_handle file{ path, ec };
+		if (ec)
+			return;
+
+		_internal::read_to_end(file, buffer, ec);
+	}
+	/**
+	 * @brief			Reads the contents of a file into a caller-owned buffer, replacing its contents & resizing it to fit the file.
+	 *\n				The buffer's storage is reused, so repeatedly loading files into the same buffer only allocates when a file is larger than any before it.
+	 * @param path		The location of the target file.
+	 * @param buffer	The buffer to read into.
+	 * @throws std::filesystem::filesystem_error	The file couldn't be read.
+	 */
+	template<byte_buffer TBuffer>
+	inline void read_into(std::filesystem::path const& path, TBuffer& buffer) noexcept(false)
+	{
+		std::error_code ec;
+		read_into(path, buffer, ec);
+		if (ec)
+			throw std::filesystem::filesystem_error("Failed to read file", path, ec);
+	}
+	/**
+	 * @brief		Reads the contents of a file as raw bytes, in binary mode.
+	 * @param path	The location of the target file.
+	 * @param ec	Receives the error that occurred, if any.
+	 * @returns		The contents of the file. If an error occurs, this contains whatever was read before it occurred.
+	 */
+	inline std::vector<std::byte> read_bytes(std::filesystem::path const& path, std::error_code& ec) noexcept(false)
+	{
+		std::vector<std::byte> buffer;
+		read_into(path, buffer, ec);
+		return buffer;
+	}
+	/**
+	 * @brief		Reads the contents of a file as raw bytes, in binary mode.
+	 * @param path	The location of the target file.
+	 * @returns		The contents of the file.
+	 * @throws std::filesystem::filesystem_error	The file couldn't be read.
+	 */
+	inline std::vector<std::byte> read_bytes(std::filesystem::path const& path) noexcept(false)
+	{
+		std::vector<std::byte> buffer;
+		read_into(path, buffer);
+		return buffer;
+	}
+	#pragma endregion BinaryRead
+
+	/**
+	 * @brief		Read the entire contents of a file into a string, which is allocated once using the size of the file.
+	 *\n			Unlike read(), the data is copied directly into the result without an intermediate stream buffer.
+	 *\n			The file is always read in binary mode.
+	 * @param path	The location of the target file.
+	 * @returns		The contents of the file, or an empty string if it couldn't be opened.
+	 */
+	inline std::string read_all(const std::filesystem::path& path)
+	{
+		std::string buffer;
+		std::error_code ec;
+		read_into(path, buffer, ec);
+		return buffer;
+	}
 }
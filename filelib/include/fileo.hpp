@@ -6,12 +6,34 @@
 #pragma once
 #include "openmode.h"
 
+#include <sysarch.h>
 #include <var.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
 #include <utility>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <filesystem>
+#include <system_error>
+
+#ifdef OS_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else // POSIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace file {
 	/**
@@ -50,8 +72,235 @@ namespace file {
 		}
 		return false;
 	}
+	/**
+	 * @brief			Write a contiguous buffer to a file with a single write call.
+	 * @param path		Target filepath
+	 * @param buffer	A view of the data to write.
+	 * @param mode		Open mode flags that control how the stream operates.
+	 * @returns			bool
+	 *\n				true	Successfully wrote all data to file without error.
+	 *\n				false	Failed to write all data to file because of an error.
+	 */
+	template<typename TChar, typename TCharTraits = std::char_traits<TChar>>
+	bool write_to(const std::filesystem::path& path, std::basic_string_view<TChar, TCharTraits> const& buffer, openmode const& mode = openmode::out | openmode::trunc)
+	{
+		if (std::basic_ofstream<TChar, TCharTraits> ofs(path, static_cast<std::ios_base::openmode>(mode)); ofs.is_open()) {
+			ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+			return ofs.good();
+		}
+		return false;
+	}
+	namespace _internal {
+		/// @returns	A path in the same directory as path that doesn't exist yet, used for writing a replacement of path.
+		inline std::filesystem::path make_temp_path(std::filesystem::path const& path)
+		{
+			static std::atomic<unsigned long long> counter{ 0 };
+		#ifdef OS_WIN
+			const auto& pid{ static_cast<unsigned long long>(GetCurrentProcessId()) };
+		#else
+			const auto& pid{ static_cast<unsigned long long>(getpid()) };
+		#endif
+			const auto& unique{ counter.fetch_add(1, std::memory_order_relaxed) ^ static_cast<unsigned long long>(std::chrono::steady_clock::now().time_since_epoch().count()) };
+
+			auto filename{ path.filename().native() };
+			filename.insert(filename.begin(), '.');
+			const auto& suffix{ ".tmp" + std::to_string(pid) + '.' + std::to_string(unique) };
+			filename.append(suffix.begin(), suffix.end());
+			return path.parent_path() / filename;
+		}
+		/**
+		 * @brief		Checks whether path can be replaced by renaming a new file over it without changing what it refers to.
+		 *\n			That's only the case when path doesn't exist yet, or when it's a regular file with a single link in a writable directory.
+		 *\n			Device files (/dev/null), FIFOs & hard linked files must be written in place instead.
+		 * @param path	Target filepath. Symbolic links are followed.
+		 * @returns		true when the file can be replaced atomically; otherwise false.
+		 */
+		inline bool is_replaceable(std::filesystem::path const& path) noexcept
+		{
+			std::error_code ec;
+			const auto& status{ std::filesystem::status(path, ec) };
+			if (status.type() == std::filesystem::file_type::not_found)
+				return true;
+			if (ec || status.type() != std::filesystem::file_type::regular)
+				return false;
+			if (const auto& links{ std::filesystem::hard_link_count(path, ec) }; ec || links > 1)
+				return false;
+		#ifndef OS_WIN
+			std::filesystem::path directory;
+			try {
+				directory = std::filesystem::canonical(path, ec).parent_path();
+			} catch (...) {
+				return false;
+			}
+			if (ec || ::access(directory.c_str(), W_OK) == -1)
+				return false;
+		#endif
+			return true;
+		}
+	}
+
+	/**
+	 * @brief			Atomically replaces the contents of a file with a buffer, so that the file is never left partially written.
+	 *\n				The buffer is written to a temporary file in the same directory with a single pass, which is then renamed over the target.
+	 *\n				Readers see either the old contents or the new contents, and a crash during the write leaves the old file intact.
+	 *\n				The permissions of the existing file are kept (on Windows, its ACL & attributes too). When path is a symbolic link, the file that it points to is replaced.
+	 * @param path		Target filepath
+	 * @param buffer	The new contents of the file.
+	 * @param durable	When true, the data & the rename are flushed to the storage device before returning, so the new contents survive a power loss.
+	 *\n				When flushing the rename fails, the file has already been replaced; this still returns true, but ec is set to the error.
+	 * @param ec		Receives the error that occurred when the file couldn't be replaced, or when the replacement couldn't be made durable.
+	 * @returns			bool
+	 *\n				true	Successfully replaced the file. When ec is set too, the new contents might not survive a power loss.
+	 *\n				false	Failed to replace the file; the previous contents are unchanged.
+	 */
+	inline bool write_atomic(std::filesystem::path const& path, std::string_view const& buffer, bool const durable, std::error_code& ec) noexcept
+	{
+		ec.clear();
+		std::filesystem::path target{ path };
+		if (std::filesystem::is_symlink(std::filesystem::symlink_status(target, ec))) {
+			target = std::filesystem::canonical(target, ec);
+			if (ec)
+				return false;
+		}
+		ec.clear(); //< symlink_status sets ec when the file doesn't exist yet
+		std::filesystem::path temp;
+		try {
+			temp = _internal::make_temp_path(target);
+		} catch (...) {
+			ec = std::make_error_code(std::errc::not_enough_memory);
+			return false;
+		}
+
+	#ifdef OS_WIN
+		const bool replacing{ GetFileAttributesW(target.c_str()) != INVALID_FILE_ATTRIBUTES };
+		const HANDLE file{ CreateFileW(temp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr) };
+		if (file == INVALID_HANDLE_VALUE) {
+			ec.assign(static_cast<int>(GetLastError()), std::system_category());
+			return false;
+		}
+		const auto& fail{ [&] {
+			ec.assign(static_cast<int>(GetLastError()), std::system_category());
+			CloseHandle(file);
+			DeleteFileW(temp.c_str());
+			return false;
+		} };
+
+		for (std::string_view remaining{ buffer }; !remaining.empty(); ) {
+			DWORD written{ 0 };
+			if (!WriteFile(file, remaining.data(), static_cast<DWORD>(std::min<size_t>(remaining.size(), 0x40000000)), &written, nullptr))
+				return fail();
+			remaining.remove_prefix(written);
+		}
+		if (durable && !FlushFileBuffers(file))
+			return fail();
+		CloseHandle(file);
+
+		// ReplaceFileW keeps the ACL, attributes & creation time of the file being replaced; MoveFileExW would give it those of the temporary file instead
+		if (replacing && ReplaceFileW(target.c_str(), temp.c_str(), nullptr, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr)) {
+			if (durable) {
+				// ReplaceFileW has no write-through option, so flush the metadata of the replaced file separately
+				if (const HANDLE replaced{ CreateFileW(target.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) }; replaced != INVALID_HANDLE_VALUE) {
+					if (!FlushFileBuffers(replaced))
+						ec.assign(static_cast<int>(GetLastError()), std::system_category());
+					CloseHandle(replaced);
+				}
+				else ec.assign(static_cast<int>(GetLastError()), std::system_category());
+			}
+			return true;
+		}
+		// the target may have been removed since it was checked, in which case the temporary file can still be moved into place
+		if (replacing && GetLastError() != ERROR_FILE_NOT_FOUND) {
+			ec.assign(static_cast<int>(GetLastError()), std::system_category());
+			DeleteFileW(temp.c_str());
+			return false;
+		}
+		if (!MoveFileExW(temp.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | (durable ? MOVEFILE_WRITE_THROUGH : 0))) {
+			ec.assign(static_cast<int>(GetLastError()), std::system_category());
+			DeleteFileW(temp.c_str());
+			return false;
+		}
+	#else
+		// keep the permissions of the file being replaced; new files get the default permissions, minus the umask
+		mode_t mode{ 0666 };
+		bool replacing{ false };
+		if (struct stat st {}; ::stat(target.c_str(), &st) == 0) {
+			mode = st.st_mode & 07777;
+			replacing = true;
+		}
+
+		const int fd{ ::open(temp.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode) };
+		if (fd == -1) {
+			ec.assign(errno, std::generic_category());
+			return false;
+		}
+		const auto& fail{ [&] {
+			ec.assign(errno, std::generic_category());
+			::close(fd);
+			::unlink(temp.c_str());
+			return false;
+		} };
+
+		// open() applies the umask to mode, so the permissions of an existing file must be restored explicitly
+		if (replacing && ::fchmod(fd, mode) == -1)
+			return fail();
+		for (std::string_view remaining{ buffer }; !remaining.empty(); ) {
+			const ssize_t written{ ::write(fd, remaining.data(), remaining.size()) };
+			if (written == -1) {
+				if (errno == EINTR)
+					continue;
+				return fail();
+			}
+			remaining.remove_prefix(static_cast<size_t>(written));
+		}
+		if (durable && ::fsync(fd) == -1)
+			return fail();
+		if (::close(fd) == -1) {
+			ec.assign(errno, std::generic_category());
+			::unlink(temp.c_str());
+			return false;
+		}
+
+		if (::rename(temp.c_str(), target.c_str()) == -1) {
+			ec.assign(errno, std::generic_category());
+			::unlink(temp.c_str());
+			return false;
+		}
+		if (durable) {
+			// the rename itself is only durable once the directory has been flushed too; the file has been replaced either way, so only ec reports a failure here
+			auto directory{ target.parent_path() };
+			if (directory.empty())
+				directory = ".";
+			if (const int dirfd{ ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC) }; dirfd != -1) {
+				if (::fsync(dirfd) == -1)
+					ec.assign(errno, std::generic_category());
+				::close(dirfd);
+			}
+			else ec.assign(errno, std::generic_category());
+		}
+	#endif
+		return true;
+	}
+	/**
+	 * @brief			Atomically replaces the contents of a file with a buffer, so that the file is never left partially written.
+	 *\n				See the overload that accepts a std::error_code for details.
+	 * @param path		Target filepath
+	 * @param buffer	The new contents of the file.
+	 * @param durable	When true, the data & the rename are flushed to the storage device before returning, so the new contents survive a power loss.
+	 *\n				A failure to flush the rename isn't reported by this overload, since the file has already been replaced; use the overload that accepts a std::error_code to detect it.
+	 * @returns			bool
+	 *\n				true	Successfully replaced the file.
+	 *\n				false	Failed to replace the file; the previous contents are unchanged.
+	 */
+	inline bool write_atomic(std::filesystem::path const& path, std::string_view const& buffer, bool const durable = false) noexcept
+	{
+		std::error_code ec;
+		return write_atomic(path, buffer, durable, ec);
+	}
+
 	/**
 	 * @brief			Write any number of objects to a file.
+	 *\n				For narrow character types, the file is replaced atomically with write_atomic(), so it's never left partially written.
+	 *\n				Targets that can't be replaced by a rename, such as device files, FIFOs & hard linked files, are written in place instead.
 	 * @tparam APPEND	When true, appends the given types to the file instead of overwriting the file's previous contents.
 	 * @tparam T...		Variadic Types
 	 * @param path		Target Filepath
@@ -67,7 +316,12 @@ namespace file {
 	{
 		std::basic_stringstream<TChar, TCharTraits, TAlloc> buffer;
 		(buffer << ... << std::forward<Ts>(data));
-		return write_to(path, std::move(buffer), openmode::out | openmode::trunc);
+		if constexpr (std::same_as<TChar, char>) {
+			if (_internal::is_replaceable(path))
+				return write_atomic(path, std::string_view{ buffer.view() });
+			return write_to(path, std::string_view{ buffer.view() }, openmode::out | openmode::trunc);
+		}
+		else return write_to(path, std::move(buffer), openmode::out | openmode::trunc);
 	}
 #	pragma warning (default:26800)// "Use of a moved-from object: "buffer" (lifetime.1)."
 
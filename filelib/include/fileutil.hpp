@@ -5,33 +5,72 @@
 
 #if LANG_CPP >= 17
 #include <filesystem>
-#else
-#include <fstream>
+#include <mapped_file.hpp>
 #endif
+#include <fstream>
+
+#include <count_bytes.hpp>
 
 #include <sstream>
 #include <algorithm>
+#include <concepts>
+#include <memory>
+#include <type_traits>
 
 namespace file {
 	/**
-	 * @brief		Counts the number of characters that appear in a given file stream.
-	 * @param ifs	Input Stream
-	 * @returns		std::streamoff
+	 * @brief			Counts the number of characters that appear in a given file stream.
+	 *\n				The stream is read in blocks, which are counted with file::count_bytes; afterwards, the stream is rewound to the beginning.
+	 * @param is		Input Stream
+	 * @param character	The character to count.
+	 * @returns			std::streamoff
 	 */
-	inline CONSTEXPR std::streamoff count(auto&& is, const char& character) noexcept(false)
+	template<class TStream> requires std::derived_from<std::remove_cvref_t<TStream>, std::istream>
+	inline std::streamoff count(TStream&& is, const char& character) noexcept(false)
 	{
-		const auto count{ std::count(std::istreambuf_iterator<char>(std::forward<decltype(is)>(is)), std::istreambuf_iterator<char>(), character) };
-		is.seekg(std::ios::beg);
+		constexpr std::streamsize BLOCK_SIZE{ 64ll * 1024ll };
+
+		std::streamoff count{ 0 };
+		if (auto* const buf{ is.rdbuf() }; buf != nullptr) {
+			// the block is too large for the stack of some threads, so it's allocated on the heap
+			const auto& block{ std::make_unique_for_overwrite<char[]>(static_cast<size_t>(BLOCK_SIZE)) };
+			for (std::streamsize n; (n = buf->sgetn(block.get(), BLOCK_SIZE)) > 0; )
+				count += static_cast<std::streamoff>(count_bytes(block.get(), static_cast<size_t>(n), character));
+		}
+		// seekg() does nothing while failbit is set
+		is.clear();
+		is.seekg(0, std::ios::beg);
 		return count;
 	}
+	/**
+	 * @brief			Counts the number of characters that appear in a given memory buffer.
+	 * @param data		Pointer to the beginning of the buffer.
+	 * @param size		The size of the buffer, in bytes.
+	 * @param character	The character to count.
+	 * @returns			std::streamoff
+	 */
+	inline std::streamoff count(const char* data, const size_t& size, const char& character) noexcept
+	{
+		return static_cast<std::streamoff>(count_bytes(data, size, character));
+	}
 	/**
 	 * @brief		Retrieve the number of newline characters in a given file.
-	 * @param ifs	Input Stream
+	 * @param is	Input Stream
 	 * @returns		std::streamoff
 	 */
-	inline CONSTEXPR std::streamoff getLineCount(std::istream& is) noexcept(false)
+	inline std::streamoff getLineCount(std::istream& is) noexcept(false)
 	{
-		return count(std::forward<decltype(is)>(is), '\n');
+		return count(is, '\n');
+	}
+	/**
+	 * @brief		Retrieve the number of newline characters in a given memory buffer.
+	 * @param data	Pointer to the beginning of the buffer.
+	 * @param size	The size of the buffer, in bytes.
+	 * @returns		std::streamoff
+	 */
+	inline std::streamoff getLineCount(const char* data, const size_t& size) noexcept
+	{
+		return count(data, size, '\n');
 	}
 
 	/**
@@ -80,6 +119,51 @@ namespace file {
 namespace file {
 	using Directory = std::vector<std::filesystem::directory_entry>;
 
+	/**
+	 * @brief			Counts the number of characters that appear in a mapped file.
+	 * @param file		A mapped file.
+	 * @param character	The character to count.
+	 * @returns			std::streamoff
+	 */
+	inline std::streamoff count(const mapped_file& file, const char& character) noexcept
+	{
+		return count(file.data(), file.size(), character);
+	}
+	/**
+	 * @brief			Counts the number of characters that appear in the specified file.
+	 *\n				Regular files are mapped into memory & counted in place; other files (pipes, procfs, etc.) are read in blocks.
+	 * @param path		The location of the target file.
+	 * @param character	The character to count.
+	 * @returns			std::streamoff; this is 0 when the file doesn't exist.
+	 */
+	inline std::streamoff count(const std::filesystem::path& path, const char& character) noexcept(false)
+	{
+		std::error_code ec;
+		if (const mapped_file file{ path, ec, access_hint::Sequential }; !ec && !file.empty())
+			return count(file, character);
+		if (std::ifstream ifs{ path, std::ios_base::in | std::ios_base::binary }; ifs.is_open())
+			return count(ifs, character);
+		return 0;
+	}
+	/**
+	 * @brief		Retrieve the number of newline characters in a mapped file.
+	 * @param file	A mapped file.
+	 * @returns		std::streamoff
+	 */
+	inline std::streamoff getLineCount(const mapped_file& file) noexcept
+	{
+		return count(file, '\n');
+	}
+	/**
+	 * @brief		Retrieve the number of newline characters in the specified file.
+	 * @param path	The location of the target file.
+	 * @returns		std::streamoff; this is 0 when the file doesn't exist.
+	 */
+	inline std::streamoff getLineCount(const std::filesystem::path& path) noexcept(false)
+	{
+		return count(path, '\n');
+	}
+
 	/**
 	 * @brief	Retrieve the current working directory.
 	 * @returns std::filesystem::path
@@ -121,19 +205,14 @@ namespace file {
 	 */
 	inline Directory getAllFilesWithExtension(std::string path, const std::string& extension)
 	{
-		auto directory_iterator{ std::filesystem::directory_iterator{ std::move(path) } };
-
+		// directory_iterator copies share their position, so the directory can only be read once
 		Directory vec;
-		vec.reserve(std::count_if(begin(directory_iterator), end(directory_iterator), [](auto&& entry) { return entry.is_regular_file(); }));
-
-		for (auto& it : directory_iterator) {
+		for (auto& it : std::filesystem::directory_iterator{ std::move(path) }) {
 			if (!it.is_regular_file())
 				continue;
-			if (const auto path{ it.path() }; path.has_extension() && path.extension() == extension)
+			if (const auto& path{ it.path() }; path.has_extension() && path.extension() == extension)
 				vec.emplace_back(it);
 		}
-
-		vec.shrink_to_fit();
 		return vec;
 	}
 
@@ -0,0 +1,164 @@
+/**
+ * @file	line_reader.hpp
+ * @author	radj307
+ * @brief	Contains the line_reader object, which streams the lines of a file through a fixed-size buffer.
+ */
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace file {
+	/**
+	 * @class	line_reader
+	 * @brief	Reads a file in fixed-size chunks into a reusable buffer, and yields each line as a std::string_view.
+	 *\n		Memory usage is bounded by the chunk size (or the longest line, if it's longer), regardless of the size of the file.
+	 *\n		Lines are split on '\n', which isn't included in the yielded lines; carriage returns are left as-is, the same as std::getline.
+	 *\n		Each string_view is only valid until the next line is read.
+	 *
+	 *			Usage:
+	 *			```cpp
+	 *			for (const std::string_view line : file::line_reader{ "big.log" }) { ... }
+	 *			```
+	 */
+	class line_reader {
+		std::ifstream file;
+		std::istream* stream;
+		std::vector<char> buffer;
+		/// @brief	The range of buffer that hasn't been yielded yet.
+		size_t head{ 0 }, tail{ 0 };
+		bool eof{ false };
+		size_t lineCount{ 0 };
+
+		/**
+		 * @brief	Moves the unread part of the buffer to the front, and reads the next chunk after it.
+		 *\n		The buffer is doubled in size when the unread part already fills it, which only happens for lines longer than the buffer.
+		 * @returns	true when any data was read; otherwise false.
+		 */
+		bool fill()
+		{
+			if (eof)
+				return false;
+
+			if (head > 0) {
+				std::memmove(buffer.data(), buffer.data() + head, tail - head);
+				tail -= head;
+				head = 0;
+			}
+			if (tail == buffer.size())
+				buffer.resize(buffer.size() * 2);
+
+			stream->read(buffer.data() + tail, static_cast<std::streamsize>(buffer.size() - tail));
+			const auto& count{ static_cast<size_t>(stream->gcount()) };
+			tail += count;
+			if (!*stream)
+				eof = true;
+			return count > 0;
+		}
+
+	public:
+		/// @brief	The default number of bytes read at a time; 1 MiB.
+		static constexpr size_t DEFAULT_CHUNK_SIZE{ 1024ull * 1024ull };
+
+		/**
+		 * @brief				Opens the specified file for reading. If it can't be opened, is_open() returns false & no lines are yielded.
+		 * @param path			The location of the target file.
+		 * @param chunkSize		The number of bytes to read at a time.
+		 */
+		line_reader(std::filesystem::path const& path, size_t const chunkSize = DEFAULT_CHUNK_SIZE) :
+			file{ path, std::ios_base::in | std::ios_base::binary },
+			stream{ &file },
+			buffer(chunkSize == 0 ? DEFAULT_CHUNK_SIZE : chunkSize)
+		{
+			eof = !file.is_open();
+		}
+		/**
+		 * @brief				Reads lines from the given input stream, which must outlive this instance.
+		 * @param is			The input stream to read from.
+		 * @param chunkSize		The number of bytes to read at a time.
+		 */
+		line_reader(std::istream& is, size_t const chunkSize = DEFAULT_CHUNK_SIZE) :
+			stream{ &is },
+			buffer(chunkSize == 0 ? DEFAULT_CHUNK_SIZE : chunkSize)
+		{}
+		line_reader(line_reader const&) = delete;
+		line_reader& operator=(line_reader const&) = delete;
+
+		/// @returns	true when the underlying stream is open; this is always true for instances that read from an existing stream.
+		bool is_open() const noexcept { return stream != &file || file.is_open(); }
+		/// @returns	The number of lines that have been read so far; this is also the line number of the most recently read line.
+		size_t line_number() const noexcept { return lineCount; }
+
+		/**
+		 * @brief		Reads the next line.
+		 * @param line	Receives a view of the line, which is valid until the next call.
+		 * @returns		true when a line was read; false when there are no more lines.
+		 */
+		bool next(std::string_view& line)
+		{
+			for (size_t scanned{ 0 }; ; ) {
+				const char* const first{ buffer.data() + head };
+				if (const void* nl{ std::memchr(first + scanned, '\n', tail - head - scanned) }; nl != nullptr) {
+					const size_t length{ static_cast<size_t>(static_cast<const char*>(nl) - first) };
+					line = std::string_view{ first, length };
+					head += length + 1;
+					++lineCount;
+					return true;
+				}
+
+				scanned = tail - head;
+				if (!fill()) {
+					if (head == tail)
+						return false;
+					// the last line doesn't end with a newline
+					line = std::string_view{ buffer.data() + head, tail - head };
+					head = tail;
+					++lineCount;
+					return true;
+				}
+			}
+		}
+
+		/**
+		 * @class	iterator
+		 * @brief	Input iterator that yields each line of a line_reader.
+		 */
+		class iterator {
+			line_reader* reader{ nullptr };
+			std::string_view line;
+
+		public:
+			using iterator_category = std::input_iterator_tag;
+			using value_type = std::string_view;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const std::string_view*;
+			using reference = const std::string_view&;
+
+			iterator() = default;
+			explicit iterator(line_reader* reader) : reader{ reader } { ++*this; }
+
+			reference operator*() const noexcept { return line; }
+			pointer operator->() const noexcept { return &line; }
+
+			iterator& operator++()
+			{
+				if (reader != nullptr && !reader->next(line))
+					reader = nullptr;
+				return *this;
+			}
+			void operator++(int) { ++*this; }
+
+			bool operator==(std::default_sentinel_t) const noexcept { return reader == nullptr; }
+		};
+
+		/// @returns	An iterator to the next line. Lines can only be iterated once.
+		iterator begin() { return iterator{ this }; }
+		/// @returns	The end-of-file sentinel.
+		std::default_sentinel_t end() const noexcept { return{}; }
+	};
+}
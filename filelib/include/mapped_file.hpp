@@ -0,0 +1,263 @@
+/**
+ * @file	mapped_file.hpp
+ * @author	radj307
+ * @brief	Contains the mapped_file object, which provides read-only access to a file by mapping it into memory.
+ */
+#pragma once
+#include <sysarch.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#ifdef OS_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace file {
+	/**
+	 * @enum	access_hint
+	 * @brief	Tells the operating system how a mapped file is going to be accessed, so it can choose an appropriate read-ahead strategy.
+	 */
+	enum class access_hint : unsigned char {
+		/// @brief	No special treatment.
+		Normal,
+		/// @brief	The file is read from beginning to end; read ahead aggressively & drop pages after they're used.
+		Sequential,
+		/// @brief	The file is read in no particular order; don't read ahead.
+		Random,
+		/// @brief	The whole file is going to be used soon; start reading it in now.
+		WillNeed,
+	};
+
+	/**
+	 * @class	mapped_file
+	 * @brief	Maps a file into memory as read-only, and unmaps it when the object is destroyed.
+	 *\n		The contents are accessed directly through the operating system's page cache, so nothing is copied.
+	 *\n		Empty files aren't mapped, and have an empty view.
+	 * @note	On POSIX systems, if the file is truncated by another process while it's mapped, accessing the truncated part raises SIGBUS.
+	 */
+	class mapped_file {
+		const char* _data{ nullptr };
+		size_t _size{ 0 };
+
+		void open(std::filesystem::path const& path, access_hint const& hint, std::error_code& ec) noexcept
+		{
+			ec.clear();
+		#ifdef OS_WIN
+			DWORD flags{ FILE_ATTRIBUTE_NORMAL };
+			if (hint == access_hint::Sequential)
+				flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+			else if (hint == access_hint::Random)
+				flags |= FILE_FLAG_RANDOM_ACCESS;
+
+			const HANDLE file{ CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, flags, nullptr) };
+			if (file == INVALID_HANDLE_VALUE) {
+				ec.assign(static_cast<int>(GetLastError()), std::system_category());
+				return;
+			}
+
+			LARGE_INTEGER size{};
+			if (!GetFileSizeEx(file, &size)) {
+				ec.assign(static_cast<int>(GetLastError()), std::system_category());
+				CloseHandle(file);
+				return;
+			}
+			if (static_cast<unsigned long long>(size.QuadPart) > (std::numeric_limits<size_t>::max)()) {
+				ec = std::make_error_code(std::errc::value_too_large);
+				CloseHandle(file);
+				return;
+			}
+			if (size.QuadPart == 0) {
+				CloseHandle(file);
+				return;
+			}
+
+			const HANDLE mapping{ CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+			CloseHandle(file);
+			if (mapping == nullptr) {
+				ec.assign(static_cast<int>(GetLastError()), std::system_category());
+				return;
+			}
+
+			// the view keeps the mapping alive after its handle is closed
+			const void* view{ MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) };
+			CloseHandle(mapping);
+			if (view == nullptr) {
+				ec.assign(static_cast<int>(GetLastError()), std::system_category());
+				return;
+			}
+
+			_data = static_cast<const char*>(view);
+			_size = static_cast<size_t>(size.QuadPart);
+		#else
+			const int fd{ ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+			if (fd == -1) {
+				ec.assign(errno, std::generic_category());
+				return;
+			}
+
+			struct stat st {};
+			if (fstat(fd, &st) == -1) {
+				ec.assign(errno, std::generic_category());
+				::close(fd);
+				return;
+			}
+			if (!S_ISREG(st.st_mode)) {
+				// special files (pipes, devices, procfs) can't be mapped, and don't report a meaningful size
+				ec = std::make_error_code(std::errc::no_such_device);
+				::close(fd);
+				return;
+			}
+			if (static_cast<unsigned long long>(st.st_size) > (std::numeric_limits<size_t>::max)()) {
+				ec = std::make_error_code(std::errc::value_too_large);
+				::close(fd);
+				return;
+			}
+			if (st.st_size == 0) {
+				::close(fd);
+				return;
+			}
+
+			// the mapping remains valid after the file descriptor is closed
+			void* view{ mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0) };
+			::close(fd);
+			if (view == MAP_FAILED) {
+				ec.assign(errno, std::generic_category());
+				return;
+			}
+
+			_data = static_cast<const char*>(view);
+			_size = static_cast<size_t>(st.st_size);
+			advise(hint);
+		#endif
+		}
+
+	public:
+		using value_type = char;
+		using size_type = size_t;
+		using const_pointer = const char*;
+		using const_iterator = const char*;
+
+		/// @brief	Creates an empty instance that doesn't map anything.
+		mapped_file() noexcept = default;
+		/**
+		 * @brief			Maps the specified file into memory.
+		 * @param path		The location of the file to map.
+		 * @param hint		How the file is going to be accessed.
+		 * @throws std::filesystem::filesystem_error	The file couldn't be opened or mapped.
+		 */
+		explicit mapped_file(std::filesystem::path const& path, access_hint const& hint = access_hint::Normal) noexcept(false)
+		{
+			std::error_code ec;
+			open(path, hint, ec);
+			if (ec)
+				throw std::filesystem::filesystem_error("Failed to map file", path, ec);
+		}
+		/**
+		 * @brief			Maps the specified file into memory without throwing exceptions.
+		 * @param path		The location of the file to map.
+		 * @param ec		Receives the error that occurred when the file couldn't be opened or mapped; the instance is empty in that case.
+		 * @param hint		How the file is going to be accessed.
+		 */
+		mapped_file(std::filesystem::path const& path, std::error_code& ec, access_hint const& hint = access_hint::Normal) noexcept
+		{
+			open(path, hint, ec);
+		}
+		mapped_file(mapped_file const&) = delete;
+		mapped_file& operator=(mapped_file const&) = delete;
+		mapped_file(mapped_file&& o) noexcept : _data{ std::exchange(o._data, nullptr) }, _size{ std::exchange(o._size, 0) } {}
+		mapped_file& operator=(mapped_file&& o) noexcept
+		{
+			if (this != &o) {
+				close();
+				_data = std::exchange(o._data, nullptr);
+				_size = std::exchange(o._size, 0);
+			}
+			return *this;
+		}
+		~mapped_file() noexcept { close(); }
+
+		/// @brief	Unmaps the file. Any views of it become invalid.
+		void close() noexcept
+		{
+			if (_data == nullptr)
+				return;
+		#ifdef OS_WIN
+			UnmapViewOfFile(_data);
+		#else
+			munmap(const_cast<char*>(_data), _size);
+		#endif
+			_data = nullptr;
+			_size = 0;
+		}
+
+		/**
+		 * @brief		Changes the access hint for the mapped memory.
+		 *\n			This has no effect on Windows, where the hint can only be given when the file is opened.
+		 * @param hint	How the file is going to be accessed.
+		 * @returns		true when the hint was applied; otherwise false.
+		 */
+		bool advise(access_hint const& hint) const noexcept
+		{
+			if (_data == nullptr)
+				return false;
+		#ifdef OS_WIN
+			(void)hint;
+			return false;
+		#else
+			int advice{ MADV_NORMAL };
+			switch (hint) {
+			case access_hint::Sequential:
+				advice = MADV_SEQUENTIAL;
+				break;
+			case access_hint::Random:
+				advice = MADV_RANDOM;
+				break;
+			case access_hint::WillNeed:
+				advice = MADV_WILLNEED;
+				break;
+			case access_hint::Normal: [[fallthrough]];
+			default:break;
+			}
+			return madvise(const_cast<char*>(_data), _size, advice) == 0;
+		#endif
+		}
+
+		/// @returns	true when a file is currently mapped; this is false for empty files.
+		bool is_mapped() const noexcept { return _data != nullptr; }
+		/// @returns	true when the view is empty.
+		bool empty() const noexcept { return _size == 0; }
+		/// @returns	The size of the mapped file, in bytes.
+		size_t size() const noexcept { return _size; }
+		/// @returns	A pointer to the beginning of the mapped file, or nullptr if it's empty.
+		const char* data() const noexcept { return _data; }
+
+		const_iterator begin() const noexcept { return _data; }
+		const_iterator end() const noexcept { return _data + _size; }
+
+		/// @returns	A string_view of the file's contents.
+		std::string_view view() const noexcept { return{ _data, _size }; }
+		/// @returns	A span of the file's contents.
+		std::span<const char> span() const noexcept { return{ _data, _size }; }
+
+		operator std::string_view() const noexcept { return view(); }
+		operator std::span<const char>() const noexcept { return span(); }
+	};
+}
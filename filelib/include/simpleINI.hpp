@@ -11,39 +11,241 @@
 #include <str/strcompare.hpp>
 #include <fileio.hpp>
 #include <fileutil.hpp>
+#include <mapped_file.hpp>
+#include <thread_pool.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
 #include <compare>
 #include <concepts>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace ini {
 #pragma region KeyComparators
+	namespace _internal {
+		/// @returns	The next (up to) 8 bytes of the given string, starting at the given position. Missing bytes are zero.
+		inline uint64_t load_word(std::string_view const& s, size_t const pos) noexcept
+		{
+			uint64_t w{ 0 };
+			std::memcpy(&w, s.data() + pos, std::min<size_t>(sizeof(w), s.size() - pos));
+			return w;
+		}
+		/**
+		 * @brief		Converts all of the uppercase ASCII letters in a word of 8 packed characters to lowercase, without branching.
+		 *\n			Bytes that aren't uppercase ASCII letters (including non-ASCII bytes) are left unchanged, matching str::tolower(char).
+		 * @param w		8 packed characters.
+		 * @returns		w with each byte in the range ['A', 'Z'] converted to lowercase.
+		 */
+		CONSTEXPR uint64_t fold_word(uint64_t const w) noexcept
+		{
+			constexpr uint64_t ONES{ 0x0101010101010101ull }, HIGH{ 0x8080808080808080ull };
+			const uint64_t low7{ w & ~HIGH };
+			const uint64_t geA{ low7 + ONES * (0x80 - 'A') };		//< high bit is set when the byte is >= 'A'
+			const uint64_t gtZ{ low7 + ONES * (0x80 - 'Z' - 1) };	//< high bit is set when the byte is > 'Z'
+			return w | (((geA & ~gtZ & ~w) & HIGH) >> 2);			//< 0x80 >> 2 == 0x20, the difference between 'A' & 'a'
+		}
+		/// @brief	Final avalanche step for the word-at-a-time key hashes. (MurmurHash3 fmix64)
+		CONSTEXPR uint64_t mix_hash(uint64_t h) noexcept
+		{
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdull;
+			h ^= h >> 33;
+			h *= 0xc4ceb9fe1a85ec53ull;
+			h ^= h >> 33;
+			return h;
+		}
+	}
+
+	/**
+	 * @struct	CaseInsensitiveHash
+	 * @brief	**Case-Insensitive** Key Hasher. Keys that compare equal with CaseInsensitiveCompare always produce the same hash.
+	 */
+	struct CaseInsensitiveHash {
+		using is_transparent = void;
+
+		size_t operator()(const std::string_view& s) const noexcept
+		{
+			uint64_t h{ s.size() * 0x9e3779b97f4a7c15ull };
+			for (size_t i{ 0 }, end{ s.size() }; i < end; i += sizeof(uint64_t))
+				h = (std::rotl(h, 5) ^ _internal::fold_word(_internal::load_word(s, i))) * 0x9e3779b97f4a7c15ull;
+			return $c(size_t, _internal::mix_hash(h));
+		}
+	};
+	/**
+	 * @struct	CaseSensitiveHash
+	 * @brief	Key Hasher that does not ignore case. This is equivalent to std::hash, but accepts any string type without converting it.
+	 */
+	struct CaseSensitiveHash {
+		using is_transparent = void;
+
+		size_t operator()(const std::string_view& s) const noexcept { return std::hash<std::string_view>{}(s); }
+	};
 	/**
 	 * @struct	CaseInsensitiveCompare
 	 * @brief	**Case-Insensitive** Key Comparator
 	 */
 	struct CaseInsensitiveCompare {
-		bool operator()(const std::string& l, const std::string& r) const noexcept { return str::tolower(l) == str::tolower(r); }
+		using is_transparent = void;
+
+		bool operator()(const std::string_view& l, const std::string_view& r) const noexcept
+		{
+			if (l.size() != r.size())
+				return false;
+			// compare 8 characters at a time, only folding the case of words that aren't already identical
+			for (size_t i{ 0 }, end{ l.size() }; i < end; i += sizeof(uint64_t)) {
+				const uint64_t wl{ _internal::load_word(l, i) }, wr{ _internal::load_word(r, i) };
+				if (wl != wr && _internal::fold_word(wl) != _internal::fold_word(wr))
+					return false;
+			}
+			return true;
+		}
 	};
 	/**
 	 * @struct	CaseSensitiveCompare
 	 * @brief	String comparison object that does not ignore case.
 	 */
 	struct CaseSensitiveCompare {
+		using is_transparent = void;
 
-		bool operator()(const std::string& l, const std::string& r) const noexcept { return l == r; }
+		bool operator()(const std::string_view& l, const std::string_view& r) const noexcept { return l == r; }
 	};
+
+	/**
+	 * @struct	ini_key_hasher
+	 * @brief	Selects the hash function to use with the given key comparator; defaults to CaseSensitiveHash.
+	 *\n		Specialize this for custom comparators that consider different strings to be equal.
+	 *\n		When both the hash function & comparator define `is_transparent`, containers can be searched with any string type without allocating.
+	 *\n		The hash function **must** produce the same value for any two keys that the comparator considers equal.
+	 */
+	template<class TKeyComparator>
+	struct ini_key_hasher {
+		using type = CaseSensitiveHash;
+	};
+	template<>
+	struct ini_key_hasher<CaseInsensitiveCompare> {
+		using type = CaseInsensitiveHash;
+	};
+	/// @brief	The hash function to use with the given key comparator. See ini_key_hasher.
+	template<class TKeyComparator>
+	using ini_key_hasher_t = typename ini_key_hasher<TKeyComparator>::type;
 #pragma endregion KeyComparators
 
 	$DefineExcept(ini_cast_exception);
 
 #pragma region ini_value
+	namespace _internal {
+		/**
+		 * @class	conversion_cache
+		 * @brief	Stores the result of the most recent successful typed conversion of an ini_value, so repeated conversions are a load rather than a parse.
+		 *\n		This is only allocated for values that opt in with ini_value::enable_conversion_cache().
+		 *\n		The cache can be populated through const references from multiple threads at once; concurrent conversions to different types never observe each other's results.
+		 */
+		class conversion_cache {
+		public:
+			/// @brief	Identifies the type of the cached value.
+			enum class kind : uint8_t {
+				None,
+				/// @brief	A thread is currently storing a value.
+				Busy,
+				Bool,
+				Signed,
+				Unsigned,
+				Float,
+				Double,
+			};
+
+		private:
+			/// @brief	The kind of the cached value in the low byte, and the parameter it was parsed with (number base or format) in the high byte.
+			std::atomic<uint16_t> tag{ 0 };
+			/// @brief	The bit pattern of the cached value.
+			std::atomic<uint64_t> bits{ 0 };
+
+			static constexpr uint16_t make_tag(kind const k, uint8_t const param) noexcept { return $c(uint16_t, $c(uint16_t, k) | (param << 8)); }
+
+			void copy_from(conversion_cache const& o) noexcept
+			{
+				const auto& t{ o.tag.load() };
+				const auto& v{ o.bits.load() };
+				if (t == make_tag(kind::Busy, 0) || o.tag.load() != t) {
+					tag.store(0);
+					return;
+				}
+				bits.store(v);
+				tag.store(t);
+			}
+
+		public:
+			conversion_cache() noexcept = default;
+			conversion_cache(conversion_cache const& o) noexcept { copy_from(o); }
+			conversion_cache(conversion_cache&& o) noexcept { copy_from(o); o.reset(); }
+			conversion_cache& operator=(conversion_cache const& o) noexcept
+			{
+				if (this != &o) copy_from(o);
+				return *this;
+			}
+			conversion_cache& operator=(conversion_cache&& o) noexcept
+			{
+				if (this != &o) {
+					copy_from(o);
+					o.reset();
+				}
+				return *this;
+			}
+
+			/// @brief	Discards the cached value. This must not be called concurrently with any other methods.
+			void reset() noexcept { tag.store(0); }
+
+			/**
+			 * @brief		Retrieves the cached value.
+			 * @param k		The kind of value to retrieve.
+			 * @param param	The number base or format that the value was parsed with.
+			 * @returns		The bit pattern of the cached value when it matches k & param; otherwise std::nullopt.
+			 */
+			std::optional<uint64_t> load(kind const k, uint8_t const param = 0) const noexcept
+			{
+				const uint16_t t{ make_tag(k, param) };
+				if (tag.load() != t)
+					return std::nullopt;
+				const uint64_t v{ bits.load() };
+				if (tag.load() != t)
+					return std::nullopt; //< overwritten by a conversion to a different type
+				return v;
+			}
+			/**
+			 * @brief		Stores a value in the cache, unless another thread is currently storing one.
+			 * @param k		The kind of value to store.
+			 * @param param	The number base or format that the value was parsed with.
+			 * @param v		The bit pattern of the value.
+			 */
+			void store(kind const k, uint8_t const param, uint64_t const v) noexcept
+			{
+				auto current{ tag.load() };
+				if (current == make_tag(kind::Busy, 0) || !tag.compare_exchange_strong(current, make_tag(kind::Busy, 0)))
+					return;
+				bits.store(v);
+				tag.store(make_tag(k, param));
+			}
+		};
+	}
+
 	/**
 	 * @class		ini_value
 	 * @brief		Wraps the std::string class, and adds additional functionality such as automatic type-casting.
@@ -51,7 +253,104 @@ namespace ini {
 	 */
 	class ini_value {
 		std::string _value;
+		/// @brief	Caches the most recent typed conversion when enabled with enable_conversion_cache(); otherwise nullptr.
+		/// @details	This is reset by every method that modifies _value, and destroyed by every method that exposes _value for modification,
+		///			 since writes through the returned reference, pointer, or iterator can't be detected.
+		std::unique_ptr<_internal::conversion_cache> _cache;
 		using this_t = ini_value;
+		using cache_kind = _internal::conversion_cache::kind;
+
+		std::optional<uint64_t> cache_load(cache_kind const k, uint8_t const param = 0) const noexcept
+		{
+			if (_cache)
+				return _cache->load(k, param);
+			return std::nullopt;
+		}
+		void cache_store(cache_kind const k, uint8_t const param, uint64_t const v) const noexcept
+		{
+			if (_cache)
+				_cache->store(k, param, v);
+		}
+		/// @brief	Discards the cached conversion, if there is one. Called by methods that modify the value.
+		void invalidate_cache() noexcept
+		{
+			if (_cache)
+				_cache->reset();
+		}
+
+		/**
+		 * @brief		Converts the value to an integral number, or retrieves the cached result of a previous conversion when the cache is enabled.
+		 *\n			Like str::tonumber, any characters following the number are ignored; "42abc" is converted to 42.
+		 * @param base	The number base to interpret the value in. The minimum is 2 and the maximum is 36.
+		 * @returns		The number when the value begins with a valid integral that fits in T; otherwise std::nullopt.
+		 */
+		template<std::integral T>
+		std::optional<T> to_integral(const uint8_t base) const noexcept
+		{
+			using cached_t = std::conditional_t<std::signed_integral<T>, long long, unsigned long long>;
+			constexpr cache_kind kind{ std::signed_integral<T> ? cache_kind::Signed : cache_kind::Unsigned };
+
+			if (base < 2 || base > 36)
+				return std::nullopt;
+
+			cached_t n{};
+			if (const auto& bits{ cache_load(kind, base) }; bits.has_value())
+				n = std::bit_cast<cached_t>(bits.value());
+			else if (std::from_chars(_value.data(), _value.data() + _value.size(), n, base).ec == std::errc{})
+				cache_store(kind, base, std::bit_cast<uint64_t>(n));
+			else return std::nullopt;
+
+			if (n < $c(cached_t, std::numeric_limits<T>::min()) || n > $c(cached_t, std::numeric_limits<T>::max()))
+				return std::nullopt;
+			return $c(T, n);
+		}
+		/**
+		 * @brief		Converts the value to a floating-point number, or retrieves the cached result of a previous conversion when the cache is enabled.
+		 *\n			Like str::tonumber, any characters following the number are ignored; "1.5abc" is converted to 1.5.
+		 *\n			Only float & double results are cached.
+		 * @param fmt	Format flags that determine what notations are allowed in the value.
+		 * @returns		The number when the value begins with a valid floating-point; otherwise std::nullopt.
+		 */
+		template<std::floating_point T>
+		std::optional<T> to_floating_point(const std::chars_format fmt) const noexcept
+		{
+			using bits_t = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+			constexpr bool cacheable{ std::same_as<T, float> || std::same_as<T, double> };
+			constexpr cache_kind kind{ std::same_as<T, float> ? cache_kind::Float : cache_kind::Double };
+
+			if constexpr (cacheable) {
+				if (const auto& bits{ cache_load(kind, $c(uint8_t, fmt)) }; bits.has_value())
+					return std::bit_cast<T>($c(bits_t, bits.value()));
+			}
+
+			T n{};
+		#if defined(__GNUC__) && __GNUC__ < 11
+			// prior to gcc 11, std::from_chars does not support floating-point types
+			std::istringstream ss{ _value };
+			if (!(ss >> n))
+				return std::nullopt;
+		#else
+			if (std::from_chars(_value.data(), _value.data() + _value.size(), n, fmt).ec != std::errc{})
+				return std::nullopt;
+		#endif
+
+			if constexpr (cacheable)
+				cache_store(kind, $c(uint8_t, fmt), std::bit_cast<bits_t>(n));
+			return n;
+		}
+		/**
+		 * @brief		Converts the value to a boolean, or retrieves the cached result of a previous conversion when the cache is enabled.
+		 * @returns		The boolean when the value is one of "true", "false", "1", "0", "on", "off", "yes", or "no" (case-insensitive); otherwise std::nullopt.
+		 */
+		std::optional<bool> to_bool() const noexcept
+		{
+			if (const auto& bits{ cache_load(cache_kind::Bool) }; bits.has_value())
+				return bits.value() != 0;
+			const auto& b{ str::tobool(_value) };
+			if (b.has_value())
+				cache_store(cache_kind::Bool, 0, b.value());
+			return b;
+		}
 
 	public:
 	#pragma region usings
@@ -85,10 +384,10 @@ namespace ini {
 		/// @brief	Ctor that accepts a boolean to convert to a string representation.
 		WINCONSTEXPR ini_value(const bool& state) : _value{ str::frombool(state) } {}
 		/// @brief	convertible (move) ctor
-		template<std::convertible_to<std::string> T> requires (!std::same_as<T, std::string>)
+		template<std::convertible_to<std::string> T> requires (!std::same_as<T, std::string>) && (!std::same_as<std::remove_cvref_t<T>, ini_value>)
 			WINCONSTEXPR ini_value(T&& v) : _value{ std::string{ std::forward<T>(v) } } {}
 		/// @brief	convertible (copy) ctor
-		template<std::convertible_to<std::string> T> requires (!std::same_as<T, std::string>)
+		template<std::convertible_to<std::string> T> requires (!std::same_as<T, std::string>) && (!std::same_as<std::remove_cvref_t<T>, ini_value>)
 			WINCONSTEXPR ini_value(const T& v) : _value{ std::string{ v } } {}
 		/**
 		 * @brief						Ctor that accepts types that aren't implicitly convertible to std::string.
@@ -104,54 +403,93 @@ namespace ini {
 		 */
 		template<typename T, var::function<std::string, T> TConverter> requires (!std::convertible_to<T, std::string>)
 			WINCONSTEXPR ini_value(const T& v, const TConverter& converter_function) : _value{ converter_function(v) } {}
+		/// @brief	copy ctor; the copy has a conversion cache when the original does.
+		ini_value(ini_value const& o) : _value{ o._value }, _cache{ o._cache ? std::make_unique<_internal::conversion_cache>(*o._cache) : nullptr } {}
+		/// @brief	move ctor
+		ini_value(ini_value&&) noexcept = default;
+		/// @brief	copy assignment operator; the copy has a conversion cache when the original does.
+		ini_value& operator=(ini_value const& o)
+		{
+			if (this != &o) {
+				_value = o._value;
+				_cache = o._cache ? std::make_unique<_internal::conversion_cache>(*o._cache) : nullptr;
+			}
+			return *this;
+		}
+		/// @brief	move assignment operator
+		ini_value& operator=(ini_value&&) noexcept = default;
 	#pragma endregion constructors
 
+	#pragma region conversion_cache
+		/**
+		 * @brief	Enables caching of this value's typed conversions, so repeatedly converting it with as(), cast(), or a cast operator is a load rather than a parse.
+		 *\n		Only the most recent successful conversion is cached, and it's discarded whenever the value is modified.
+		 *\n		Methods that return a mutable reference, pointer, or iterator to the value disable the cache, since writes through them can't be detected.
+		 * @returns	*this
+		 */
+		this_t& enable_conversion_cache()
+		{
+			if (!_cache)
+				_cache = std::make_unique<_internal::conversion_cache>();
+			return *this;
+		}
+		/// @brief	Disables caching of this value's typed conversions, and releases the cache.
+		this_t& disable_conversion_cache() noexcept
+		{
+			_cache.reset();
+			return *this;
+		}
+		/// @returns	true when typed conversions of this value are cached; see enable_conversion_cache().
+		bool has_conversion_cache() const noexcept { return _cache != nullptr; }
+	#pragma endregion conversion_cache
+
 	#pragma region string_methods
 		// Manually forwarded from: https://en.cppreference.com/w/cpp/string/basic_string
+		// Non-const methods that modify the value reset the conversion cache, and those that return a mutable reference, pointer, or iterator disable it.
 
-		WINCONSTEXPR this_t& assign(size_type count, value_type ch) { _value.assign(count, ch); return *this; }
-		WINCONSTEXPR this_t& assign(const this_t& str) { _value.assign(str._value); return *this; }
-		WINCONSTEXPR this_t& assign(const std::string& str) { _value.assign(str); return *this; }
-		WINCONSTEXPR this_t& assign(const this_t& str, size_type pos, size_type count = std::string::npos) { _value.assign(str._value, pos, count); return *this; }
-		WINCONSTEXPR this_t& assign(const std::string& str, size_type pos, size_type count = std::string::npos) { _value.assign(str, pos, count); return *this; }
-		WINCONSTEXPR this_t& assign(this_t&& str) noexcept { _value.assign(std::move(str)._value); return *this; }
-		WINCONSTEXPR this_t& assign(std::string&& str) noexcept { _value.assign(std::move(str)); return *this; }
-		template<class StringViewLike> WINCONSTEXPR this_t& assign(const StringViewLike& t, size_type pos, size_type count = std::string::npos) { _value.assign(t, pos, count); return *this; }
+		WINCONSTEXPR this_t& assign(size_type count, value_type ch) { invalidate_cache(); _value.assign(count, ch); return *this; }
+		WINCONSTEXPR this_t& assign(const this_t& str) { invalidate_cache(); _value.assign(str._value); return *this; }
+		WINCONSTEXPR this_t& assign(const std::string& str) { invalidate_cache(); _value.assign(str); return *this; }
+		WINCONSTEXPR this_t& assign(const this_t& str, size_type pos, size_type count = std::string::npos) { invalidate_cache(); _value.assign(str._value, pos, count); return *this; }
+		WINCONSTEXPR this_t& assign(const std::string& str, size_type pos, size_type count = std::string::npos) { invalidate_cache(); _value.assign(str, pos, count); return *this; }
+		WINCONSTEXPR this_t& assign(this_t&& str) noexcept { invalidate_cache(); _value.assign(std::move(str)._value); return *this; }
+		WINCONSTEXPR this_t& assign(std::string&& str) noexcept { invalidate_cache(); _value.assign(std::move(str)); return *this; }
+		template<class StringViewLike> WINCONSTEXPR this_t& assign(const StringViewLike& t, size_type pos, size_type count = std::string::npos) { invalidate_cache(); _value.assign(t, pos, count); return *this; }
 
 		WINCONSTEXPR allocator_type get_allocator() const noexcept { return _value.get_allocator(); }
 
-		WINCONSTEXPR reference at(const size_type& pos) { return _value.at(pos); }
+		WINCONSTEXPR reference at(const size_type& pos) { disable_conversion_cache(); return _value.at(pos); }
 		WINCONSTEXPR const_reference at(const size_type& pos) const { return _value.at(pos); }
 
-		WINCONSTEXPR reference operator[](const size_t& idx) noexcept { return _value[idx]; }
+		WINCONSTEXPR reference operator[](const size_t& idx) noexcept { disable_conversion_cache(); return _value[idx]; }
 		WINCONSTEXPR const_reference operator[](const size_t& idx) const noexcept { return _value[idx]; }
 
-		WINCONSTEXPR reference front() { return _value.front(); }
+		WINCONSTEXPR reference front() { disable_conversion_cache(); return _value.front(); }
 		WINCONSTEXPR const_reference front() const { return _value.front(); }
 
-		WINCONSTEXPR reference back() { return _value.back(); }
+		WINCONSTEXPR reference back() { disable_conversion_cache(); return _value.back(); }
 		WINCONSTEXPR const_reference back() const { return _value.back(); }
 
-		WINCONSTEXPR pointer data() noexcept { return _value.data(); }
+		WINCONSTEXPR pointer data() noexcept { disable_conversion_cache(); return _value.data(); }
 		WINCONSTEXPR const_pointer data() const noexcept { return _value.data(); }
 
 		WINCONSTEXPR const_pointer c_str() const noexcept { return _value.c_str(); }
 
 		WINCONSTEXPR operator std::string_view() const noexcept { return _value.operator std::basic_string_view<char, std::char_traits<char>>(); }
 
-		WINCONSTEXPR iterator begin() noexcept { return _value.begin(); }
+		WINCONSTEXPR iterator begin() noexcept { disable_conversion_cache(); return _value.begin(); }
 		WINCONSTEXPR const_iterator begin() const noexcept { return _value.begin(); }
 		WINCONSTEXPR const_iterator cbegin() const noexcept { return _value.cbegin(); }
 
-		WINCONSTEXPR iterator end() noexcept { return _value.end(); }
+		WINCONSTEXPR iterator end() noexcept { disable_conversion_cache(); return _value.end(); }
 		WINCONSTEXPR const_iterator end() const noexcept { return _value.end(); }
 		WINCONSTEXPR const_iterator cend() const noexcept { return _value.cend(); }
 
-		WINCONSTEXPR reverse_iterator rbegin() noexcept { return _value.rbegin(); }
+		WINCONSTEXPR reverse_iterator rbegin() noexcept { disable_conversion_cache(); return _value.rbegin(); }
 		WINCONSTEXPR const_reverse_iterator rbegin() const noexcept { return _value.rbegin(); }
 		WINCONSTEXPR const_reverse_iterator crbegin() const noexcept { return _value.crbegin(); }
 
-		WINCONSTEXPR reverse_iterator rend() noexcept { return _value.rend(); }
+		WINCONSTEXPR reverse_iterator rend() noexcept { disable_conversion_cache(); return _value.rend(); }
 		WINCONSTEXPR const_reverse_iterator rend() const noexcept { return _value.rend(); }
 		WINCONSTEXPR const_reverse_iterator crend() const noexcept { return _value.crend(); }
 
@@ -168,42 +506,42 @@ namespace ini {
 
 		WINCONSTEXPR void shrink_to_fit() { _value.shrink_to_fit(); }
 
-		WINCONSTEXPR void clear() noexcept { _value.clear(); }
-
-		WINCONSTEXPR this_t& insert(const size_type& index, const size_type& count, const value_type& c) { _value.insert(index, count, c); return *this; }
-		WINCONSTEXPR this_t& insert(const size_type& index, const value_type* s) { _value.insert(index, s); return *this; }
-		WINCONSTEXPR this_t& insert(const size_type& index, const value_type* s, const size_type& count) { _value.insert(index, s, count); return *this; }
-		WINCONSTEXPR this_t& insert(const size_type& index, const std::string& str) { _value.insert(index, str); return *this; }
-		WINCONSTEXPR this_t& insert(const size_type& index, const std::string& str, const size_type& index_str, const size_type& count = std::string::npos) { _value.insert(index, str, index_str, count); return *this; }
-		WINCONSTEXPR iterator insert(const_iterator pos, const value_type& ch) { return _value.insert(pos, ch); }
-		WINCONSTEXPR iterator insert(const_iterator pos, const size_type& count, const value_type& ch) { return _value.insert(pos, count, ch); }
-		template<class InputIt> WINCONSTEXPR iterator insert(const_iterator pos, InputIt first, InputIt last) { return _value.insert(pos, first, last); }
-		WINCONSTEXPR iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) { return _value.insert(pos, ilist); }
-		template<class StringViewLike> WINCONSTEXPR this_t& insert(const size_type& pos, const StringViewLike& t) { _value.insert(pos, t); return *this; }
-		template<class StringViewLike> WINCONSTEXPR this_t& insert(const size_type& index, const StringViewLike& t, const size_type& index_str, const size_type& count = std::string::npos) { _value.insert(index, t, index_str, count); return *this; }
-
-		WINCONSTEXPR this_t& erase(const size_type& index = 0, const size_type& count = std::string::npos) { _value.erase(index, count); return *this; }
-		WINCONSTEXPR iterator erase(const_iterator position) { return _value.erase(position); }
-		WINCONSTEXPR iterator erase(const_iterator first, const_iterator last) { return _value.erase(first, last); }
-
-		WINCONSTEXPR void push_back(const value_type& ch) { _value.push_back(ch); }
-		WINCONSTEXPR void pop_back() { _value.pop_back(); }
-
-		WINCONSTEXPR this_t& append(size_type count, value_type ch) { _value.append(count, ch); return *this; }
-		WINCONSTEXPR this_t& append(const this_t& str) { _value.append(str); return *this; }
-		WINCONSTEXPR this_t& append(const this_t& str, size_type pos, size_type count = std::string::npos) { _value.append(str, pos, count); return *this; }
-		WINCONSTEXPR this_t& append(const value_type* s, size_type count) { _value.append(s, count); return *this; }
-		WINCONSTEXPR this_t& append(const value_type* s) { _value.append(s); return *this; }
-		template<class InputIt> WINCONSTEXPR this_t& append(InputIt first, InputIt last) { _value.append(first, last); return *this; }
-		WINCONSTEXPR this_t& append(std::initializer_list<value_type> ilist) { _value.append(ilist); return *this; }
-		template<class StringViewLike> WINCONSTEXPR this_t& append(const StringViewLike& t) { _value.append(t); return *this; }
-		template<class StringViewLike> WINCONSTEXPR this_t& append(const StringViewLike& t, size_type pos, size_type count = std::string::npos) { _value.append(t, pos, count); return *this; }
-
-		WINCONSTEXPR this_t& operator+=(const std::string& str) { _value += str; return *this; }
-		WINCONSTEXPR this_t& operator+=(value_type ch) { _value += ch; return *this; }
-		WINCONSTEXPR this_t& operator+=(const value_type* s) { _value += s; return *this; }
-		WINCONSTEXPR this_t& operator+=(std::initializer_list<value_type> ilist) { _value += ilist; return *this; }
-		template<class StringViewLike> WINCONSTEXPR this_t& operator+=(const StringViewLike& t) { _value += t; return *this; }
+		WINCONSTEXPR void clear() noexcept { invalidate_cache(); _value.clear(); }
+
+		WINCONSTEXPR this_t& insert(const size_type& index, const size_type& count, const value_type& c) { invalidate_cache(); _value.insert(index, count, c); return *this; }
+		WINCONSTEXPR this_t& insert(const size_type& index, const value_type* s) { invalidate_cache(); _value.insert(index, s); return *this; }
+		WINCONSTEXPR this_t& insert(const size_type& index, const value_type* s, const size_type& count) { invalidate_cache(); _value.insert(index, s, count); return *this; }
+		WINCONSTEXPR this_t& insert(const size_type& index, const std::string& str) { invalidate_cache(); _value.insert(index, str); return *this; }
+		WINCONSTEXPR this_t& insert(const size_type& index, const std::string& str, const size_type& index_str, const size_type& count = std::string::npos) { invalidate_cache(); _value.insert(index, str, index_str, count); return *this; }
+		WINCONSTEXPR iterator insert(const_iterator pos, const value_type& ch) { disable_conversion_cache(); return _value.insert(pos, ch); }
+		WINCONSTEXPR iterator insert(const_iterator pos, const size_type& count, const value_type& ch) { disable_conversion_cache(); return _value.insert(pos, count, ch); }
+		template<class InputIt> WINCONSTEXPR iterator insert(const_iterator pos, InputIt first, InputIt last) { disable_conversion_cache(); return _value.insert(pos, first, last); }
+		WINCONSTEXPR iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) { disable_conversion_cache(); return _value.insert(pos, ilist); }
+		template<class StringViewLike> WINCONSTEXPR this_t& insert(const size_type& pos, const StringViewLike& t) { invalidate_cache(); _value.insert(pos, t); return *this; }
+		template<class StringViewLike> WINCONSTEXPR this_t& insert(const size_type& index, const StringViewLike& t, const size_type& index_str, const size_type& count = std::string::npos) { invalidate_cache(); _value.insert(index, t, index_str, count); return *this; }
+
+		WINCONSTEXPR this_t& erase(const size_type& index = 0, const size_type& count = std::string::npos) { invalidate_cache(); _value.erase(index, count); return *this; }
+		WINCONSTEXPR iterator erase(const_iterator position) { disable_conversion_cache(); return _value.erase(position); }
+		WINCONSTEXPR iterator erase(const_iterator first, const_iterator last) { disable_conversion_cache(); return _value.erase(first, last); }
+
+		WINCONSTEXPR void push_back(const value_type& ch) { invalidate_cache(); _value.push_back(ch); }
+		WINCONSTEXPR void pop_back() { invalidate_cache(); _value.pop_back(); }
+
+		WINCONSTEXPR this_t& append(size_type count, value_type ch) { invalidate_cache(); _value.append(count, ch); return *this; }
+		WINCONSTEXPR this_t& append(const this_t& str) { invalidate_cache(); _value.append(str); return *this; }
+		WINCONSTEXPR this_t& append(const this_t& str, size_type pos, size_type count = std::string::npos) { invalidate_cache(); _value.append(str, pos, count); return *this; }
+		WINCONSTEXPR this_t& append(const value_type* s, size_type count) { invalidate_cache(); _value.append(s, count); return *this; }
+		WINCONSTEXPR this_t& append(const value_type* s) { invalidate_cache(); _value.append(s); return *this; }
+		template<class InputIt> WINCONSTEXPR this_t& append(InputIt first, InputIt last) { invalidate_cache(); _value.append(first, last); return *this; }
+		WINCONSTEXPR this_t& append(std::initializer_list<value_type> ilist) { invalidate_cache(); _value.append(ilist); return *this; }
+		template<class StringViewLike> WINCONSTEXPR this_t& append(const StringViewLike& t) { invalidate_cache(); _value.append(t); return *this; }
+		template<class StringViewLike> WINCONSTEXPR this_t& append(const StringViewLike& t, size_type pos, size_type count = std::string::npos) { invalidate_cache(); _value.append(t, pos, count); return *this; }
+
+		WINCONSTEXPR this_t& operator+=(const std::string& str) { invalidate_cache(); _value += str; return *this; }
+		WINCONSTEXPR this_t& operator+=(value_type ch) { invalidate_cache(); _value += ch; return *this; }
+		WINCONSTEXPR this_t& operator+=(const value_type* s) { invalidate_cache(); _value += s; return *this; }
+		WINCONSTEXPR this_t& operator+=(std::initializer_list<value_type> ilist) { invalidate_cache(); _value += ilist; return *this; }
+		template<class StringViewLike> WINCONSTEXPR this_t& operator+=(const StringViewLike& t) { invalidate_cache(); _value += t; return *this; }
 
 		WINCONSTEXPR int compare(const this_t& str) const noexcept { return _value.compare(str._value); }
 		WINCONSTEXPR int compare(const std::string& str) const noexcept { return _value.compare(str); }
@@ -238,14 +576,14 @@ namespace ini {
 
 		WINCONSTEXPR size_type copy(value_type* dest, size_type count, size_type pos = 0) const { return _value.copy(dest, count, pos); }
 
-		WINCONSTEXPR void resize(const size_type& count) { _value.resize(count); }
-		WINCONSTEXPR void resize(const size_type& count, value_type ch) { _value.resize(count, ch); }
+		WINCONSTEXPR void resize(const size_type& count) { invalidate_cache(); _value.resize(count); }
+		WINCONSTEXPR void resize(const size_type& count, value_type ch) { invalidate_cache(); _value.resize(count, ch); }
 
 	#if LANG_CPP >= 23
-		template<class Operation> WINCONSTEXPR void resize_and_overwrite(size_type count, Operation op) { _value.resize_and_overwrite(count, op); }
+		template<class Operation> WINCONSTEXPR void resize_and_overwrite(size_type count, Operation op) { invalidate_cache(); _value.resize_and_overwrite(count, op); }
 	#endif
 
-		WINCONSTEXPR void swap(std::string& other) noexcept { _value.swap(other); }
+		WINCONSTEXPR void swap(std::string& other) noexcept { invalidate_cache(); _value.swap(other); }
 
 		WINCONSTEXPR size_type find(const std::string str, const size_type pos = 0) const noexcept { return _value.find(str, pos); }
 		WINCONSTEXPR size_type find(const value_type* s, const size_type pos, const size_type count) const { return _value.find(s, pos, count); }
@@ -285,12 +623,17 @@ namespace ini {
 	#pragma endregion string_methods
 
 	#pragma region cast_operators
-		WINCONSTEXPR operator std::string& () noexcept { return _value; }
-		WINCONSTEXPR operator std::string() const noexcept { return _value; }
+		/// @brief	String casting operator. There's no mutable equivalent, since writes through it would bypass the conversion cache; use the string methods or assignment instead.
+		WINCONSTEXPR operator std::string const& () const noexcept { return _value; }
 		/// @brief	Bool casting operator.
-		WINCONSTEXPR explicit operator bool() const noexcept { return str::tobool(_value).value_or(false); }
+		WINCONSTEXPR explicit operator bool() const noexcept { return to_bool().value_or(false); }
 		/// @brief	Numeric casting operator.
-		template<var::numeric T> WINCONSTEXPR explicit operator T() const noexcept { return str::tonumber<T>(_value); }
+		template<var::numeric T> WINCONSTEXPR explicit operator T() const noexcept
+		{
+			if constexpr (std::floating_point<T>)
+				return to_floating_point<T>(std::chars_format::general).value_or(T{});
+			else return to_integral<T>(10).value_or(T{});
+		}
 	#pragma endregion cast_operators
 
 	#pragma region set
@@ -308,66 +651,81 @@ namespace ini {
 	#pragma endregion set
 
 	#pragma region operator=
-		template<std::convertible_to<std::string> T> requires (!std::same_as<std::string, T>)
+		template<std::convertible_to<std::string> T> requires (!std::same_as<std::string, T>) && (!std::same_as<std::remove_cvref_t<T>, ini_value>)
 			this_t& operator=(T&& value)
 		{
+			invalidate_cache();
 			_value = std::string{ std::move(value) };
 			return *this;
 		}
-		template<std::convertible_to<std::string> T> requires (!std::same_as<std::string, T>)
+		template<std::convertible_to<std::string> T> requires (!std::same_as<std::string, T>) && (!std::same_as<std::remove_cvref_t<T>, ini_value>)
 			this_t& operator=(const T& value)
 		{
+			invalidate_cache();
 			_value = std::string{ value };
 			return *this;
 		}
 		template<std::floating_point T>
 		this_t& operator=(const T& fp)
 		{
+			invalidate_cache();
 			_value = std::to_string(fp);
 			return *this;
 		}
 		template<std::integral T>
 		this_t& operator=(const T& integral)
 		{
+			invalidate_cache();
 			_value = std::to_string(integral);
 			return *this;
 		}
 		this_t& operator=(const bool& boolean)
 		{
+			invalidate_cache();
 			_value = str::stringify(std::boolalpha, boolean);
 			return *this;
 		}
 		this_t& operator=(const std::string& s)
 		{
+			invalidate_cache();
 			_value = s;
 			return *this;
 		}
 		this_t& operator=(std::string&& s)
 		{
+			invalidate_cache();
 			_value = std::move(s);
 			return *this;
 		}
 	#pragma endregion operator=
 
 	#pragma region operator<=>
-		WINCONSTEXPR auto operator<=>(const ini_value& o) const = default;
+		WINCONSTEXPR auto operator<=>(const ini_value& o) const { return _value <=> o._value; }
+		WINCONSTEXPR bool operator==(const ini_value& o) const { return _value == o._value; }
 		WINCONSTEXPR auto operator<=>(const std::string& s) const { return _value <=> s; }
 	#pragma endregion operator<=>
 
 	#pragma region cast
 		template<std::same_as<std::string> T>
 		WINCONSTEXPR T cast() const noexcept { return _value; }
-		template<std::integral T> requires std::convertible_to<long long, T> || std::convertible_to<unsigned long long, T>
+		template<std::same_as<bool> T>
+		WINCONSTEXPR T cast() const noexcept(false)
+		{
+			if (const auto& b{ to_bool() }; b.has_value())
+				return b.value();
+			else throw ex::make_custom_exception<ini_cast_exception>("Value string '", _value, "' does not specify a valid boolean!");
+		}
+		template<std::integral T> requires (!std::same_as<T, bool>) && (std::convertible_to<long long, T> || std::convertible_to<unsigned long long, T>)
 		WINCONSTEXPR T cast(const uint8_t base = 10) const noexcept(false)
 		{
-			if (const auto& n{ str::tonumber<T>(_value, base) }; n.has_value())
+			if (const auto& n{ to_integral<T>(base) }; n.has_value())
 				return n.value();
 			else throw ex::make_custom_exception<ini_cast_exception>("Value string '", _value, "' does not specify a valid integral number!");
 		}
 		template<std::floating_point T> requires std::convertible_to<long double, T>
 		WINCONSTEXPR T cast(const std::chars_format fmt = std::chars_format::general) const noexcept(false)
 		{
-			if (const auto& n{ str::tonumber<T>(_value, fmt) }; n.has_value())
+			if (const auto& n{ to_floating_point<T>(fmt) }; n.has_value())
 				return n.value();
 			else throw ex::make_custom_exception<ini_cast_exception>("Value string '", _value, "' does not specify a valid floating-point number!");
 		}
@@ -383,23 +741,13 @@ namespace ini {
 	#pragma region as
 		template<std::same_as<std::string> T>
 		WINCONSTEXPR std::optional<T> as() const noexcept { return _value; }
-		template<std::integral T>
-		WINCONSTEXPR std::optional<T> as(const uint8_t base = 10) const noexcept
-		{
-			if ((base < 2 || base > 32) && str::isnumber<T>(_value, base)) {
-				if constexpr (std::unsigned_integral<T>)
-					return $c(T, std::stoull(_value, nullptr, base));
-				else return $c(T, std::stoll(_value, nullptr, base));
-			}
-			return std::nullopt;
-		}
+		template<std::same_as<bool> T>
+		WINCONSTEXPR std::optional<T> as() const noexcept { return to_bool(); }
+		template<std::integral T> requires (!std::same_as<T, bool>)
+		WINCONSTEXPR std::optional<T> as(const uint8_t base = 10) const noexcept { return to_integral<T>(base); }
+		/// @brief	Floating-point conversion. When base is 16 the value is read as a hexadecimal floating-point (without "0x"); otherwise it's read in fixed or scientific notation.
 		template<std::floating_point T>
-		WINCONSTEXPR std::optional<T> as(const uint8_t base = 10) const noexcept
-		{
-			if ((base < 2 || base > 32) && str::isnumber<T>(_value, base))
-				return $c(T, std::stold(_value));
-			return std::nullopt;
-		}
+		WINCONSTEXPR std::optional<T> as(const uint8_t base = 10) const noexcept { return to_floating_point<T>(base == 16 ? std::chars_format::hex : std::chars_format::general); }
 		template<var::convertible_from<std::string> T> requires (!std::same_as<std::string, T>)
 			WINCONSTEXPR std::optional<T> as() const noexcept { return T{ _value }; }
 		template<typename T, var::function<T, std::string> TConverter>
@@ -415,6 +763,7 @@ namespace ini {
 		template<typename TChar, typename TCharTraits>
 		friend std::basic_istream<TChar, TCharTraits>& operator>>(std::basic_istream<TChar, TCharTraits>& is, ini_value& v)
 		{
+			v.invalidate_cache();
 			return is >> v._value;
 		}
 	#pragma endregion operators<<&>>
@@ -424,16 +773,72 @@ namespace ini {
 #pragma region ContainerTypes
 	/// @brief	An inner section of an INI storage object. Throughout the documentation, this type is known as a 'section' and its keys are known as 'Keys', while its values are known as 'Values'.
 	template<class TKeyComparator = CaseInsensitiveCompare>
-	using ini_section = typename std::unordered_map<std::string, ini_value, std::hash<std::string>, TKeyComparator>;
+	using ini_section = typename std::unordered_map<std::string, ini_value, ini_key_hasher_t<TKeyComparator>, TKeyComparator>;
 
 	/// @brief	The outer container of an INI storage object. Throughout the documentation, this type is known as a 'map' or 'container' and its keys are known as 'Headers', while its values are known as 'Sections'.
 	template<class TKeyComparator = CaseInsensitiveCompare>
-	using ini_container = typename std::unordered_map<std::string, ini_section<TKeyComparator>, std::hash<std::string>, TKeyComparator>;
+	using ini_container = typename std::unordered_map<std::string, ini_section<TKeyComparator>, ini_key_hasher_t<TKeyComparator>, TKeyComparator>;
 
 	template<class TKeyComparator = CaseInsensitiveCompare>
 	using ini_mask = ini_container<TKeyComparator>;
+
+	/// @brief	Non-owning equivalent of ini_section, where keys & values are views into the buffer that was parsed. See parse_view().
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	using ini_section_view = typename std::unordered_map<std::string_view, std::string_view, ini_key_hasher_t<TKeyComparator>, TKeyComparator>;
+
+	/// @brief	Non-owning equivalent of ini_container, where headers are views into the buffer that was parsed. See parse_view().
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	using ini_container_view = typename std::unordered_map<std::string_view, ini_section_view<TKeyComparator>, ini_key_hasher_t<TKeyComparator>, TKeyComparator>;
 #pragma endregion ContainerTypes
 
+#pragma region ContainerLookup
+	namespace _internal {
+		/**
+		 * @brief		Gets the value of the given key, without converting it to the map's key type.
+		 * @param map	An ini_container or ini_section.
+		 * @param key	The key to search for.
+		 * @returns		A reference to the value associated with key.
+		 * @throws		std::out_of_range when the key doesn't exist.
+		 */
+		template<class TMap>
+		auto& at(TMap& map, std::string_view const& key) noexcept(false)
+		{
+			if (const auto& it{ map.find(key) }; it != map.end())
+				return it->second;
+			throw std::out_of_range(std::string{ "Key '" }.append(key).append("' doesn't exist!"));
+		}
+		/**
+		 * @brief		Gets the value of the given key, or inserts a default-constructed value when it doesn't exist.
+		 *\n			Unlike operator[], a key string is only constructed when the key has to be inserted.
+		 * @param map	An ini_container or ini_section.
+		 * @param key	The key to search for.
+		 * @returns		A reference to the value associated with key.
+		 */
+		template<class TMap>
+		typename TMap::mapped_type& find_or_insert(TMap& map, std::string_view const& key)
+		{
+			if (const auto& it{ map.find(key) }; it != map.end())
+				return it->second;
+			return map.try_emplace(typename TMap::key_type{ key }).first->second;
+		}
+		/**
+		 * @brief		Removes the given key from the map, without converting it to the map's key type.
+		 * @param map	An ini_container or ini_section.
+		 * @param key	The key to remove.
+		 * @returns		The number of elements that were removed.
+		 */
+		template<class TMap>
+		size_t erase_key(TMap& map, std::string_view const& key)
+		{
+			if (const auto& it{ map.find(key) }; it != map.end()) {
+				map.erase(it);
+				return 1ull;
+			}
+			return 0ull;
+		}
+	}
+#pragma endregion ContainerLookup
+
 #pragma region Enum
 	/**
 	 * @enum	OverrideStyle
@@ -531,14 +936,17 @@ namespace ini {
 
 	#pragma region Methods
 		/// @returns	true when the mask contains the given header, or the mask is empty *(it wasn't specified)*; otherwise false.
-		STRCONSTEXPR bool _$maskIncludes(const std::string& header) const noexcept
+		STRCONSTEXPR bool _$maskIncludes(const std::string_view& header) const noexcept
 		{
 			return mask.empty() || mask.contains(header);
 		}
 		/// @returns	true when the mask contains the given header/key, or the mask is empty *(it wasn't specified)*; otherwise false.
-		STRCONSTEXPR bool _$maskIncludes(const std::string& header, const std::string& key) const noexcept
+		STRCONSTEXPR bool _$maskIncludes(const std::string_view& header, const std::string_view& key) const noexcept
 		{
-			return mask.empty() || (mask.contains(header) && mask.at(header).contains(key));
+			if (mask.empty())
+				return true;
+			const auto& it{ mask.find(header) };
+			return it != mask.end() && it->second.contains(key);
 		}
 		/// @returns	true if the given character is an escape character; otherwise false.
 		CONSTEXPR bool _$isEscapeChar(const char c) const noexcept
@@ -550,56 +958,6 @@ namespace ini {
 		{
 			return (commentChars.find(c) != std::string::npos);
 		}
-		/// @returns	A string_view of the parameter 'line' that excludes any line comments, as determined by the commentStyle & some mild parsing.
-		STRCONSTEXPR std::string_view _$stripComments(std::string const& line) const noexcept
-		{
-			bool escaped{ false }, single_quoted{ false }, double_quoted{ false };
-			for (size_t i{ 0 }, end{ line.size() }; i < end; ++i) {
-				const char& c{ line.at(i) };
-
-				if (escaped)
-					escaped = false;
-				else if (_$isEscapeChar(c))
-					escaped = true;
-				else if (c == '\'')
-					single_quoted = !single_quoted;
-				else if (c == '\"')
-					double_quoted = !double_quoted;
-				else if (!single_quoted && !double_quoted && _$isCommentChar(c))
-					return std::string_view{ line.begin(), line.begin() + i };
-				// else continue
-			}
-			return std::string_view{ line };
-		}
-		/// @returns	A pair of iterators pointing to enclosing *(must be matching & both unescaped)* quotation marks in the given string. If no valid enclosing quotes are found, returns { value.end(), value.end() } instead.
-		STRCONSTEXPR std::pair<typename std::string::const_iterator, typename std::string::const_iterator> _$findEnclosingQuotes(std::string const& value) const noexcept
-		{
-			size_t i;
-			char delim;
-			const auto& findDelim{ [&value, &i, &delim, this](auto&& ch) {
-				const auto& idx{ i++ };
-				return ($fwd(ch) == delim && (idx == 0 || (idx > 0 && !_$isEscapeChar(value.at(idx - 1)))));
-			} };
-
-			// find double quotes
-			i = 0ull;
-			delim = '\"';
-			if (const auto& fst{ std::find_if(value.begin(), value.end(), findDelim) }; fst != value.end()) {
-				if (const auto& snd{ std::find_if(fst + 1, value.end(), findDelim) }; snd != value.end()) {
-					return{ fst, snd };
-				}
-			}
-
-			// find single quotes
-			i = 0ull;
-			delim = '\'';
-			if (const auto& fst{ std::find_if(value.begin(), value.end(), findDelim) }; fst != value.end()) {
-				if (const auto& snd{ std::find_if(fst + 1, value.end(), findDelim) }; snd != value.end()) {
-					return{ fst, snd };
-				}
-			}
-			return{ value.end(), value.end() };
-		}
 	#pragma endregion Methods
 	};
 
@@ -611,6 +969,70 @@ namespace ini {
 	$DefineExcept(ini_mask_exception);
 
 #pragma region deep_merge
+	namespace _internal {
+		/**
+		 * @brief					Merges an incoming value into the value of a key that exists in both of the containers being merged.
+		 * @param existing			The current value of the key.
+		 * @param incoming			The incoming value of the key.
+		 * @param overrideStyle		The header/key override style to use.
+		 * @param header			The name of the key's header; used for error messages.
+		 * @param key				The name of the key; used for error messages.
+		 */
+		template<class TValue>
+		void merge_value(ini_value& existing, TValue&& incoming, OverrideStyle const& overrideStyle, std::string_view const& header, std::string_view const& key) noexcept(false)
+		{
+			switch (overrideStyle) {
+			case OverrideStyle::OnlyBlank:
+				if (!existing.empty())
+					break; //< break if current value is NOT empty
+				else [[fallthrough]];
+			case OverrideStyle::Override:
+				existing = std::forward<TValue>(incoming);
+				break;
+			case OverrideStyle::Throw:
+				throw ex::make_custom_exception<ini_key_exception>("Duplicate keys aren't allowed; '", header, (header.empty() ? "" : "::"), key, "' already has value '", existing, "'! (Incoming value: '", incoming, "')");
+			case OverrideStyle::Skip: [[fallthrough]];
+			default:break;
+			}
+		}
+		/**
+		 * @brief						Performs a recursive merge of two given INI containers. When other is an rvalue, its sections & values are moved rather than copied.
+		 * @param container				Input container reference.
+		 * @param other					Other container.
+		 * @param overrideStyle			The header/key override style to use for duplicate headers/keys.
+		 * @param maskRemovesExisting	When true, keys in container that aren't present in the corresponding section of other are removed.
+		 */
+		template<class TContainer, class TOther>
+		void merge_into(TContainer& container, TOther&& other, OverrideStyle const& overrideStyle, bool const maskRemovesExisting) noexcept(false)
+		{
+			constexpr bool MOVE{ !std::is_lvalue_reference_v<TOther> };
+
+			for (auto& [header, section] : other) {
+				const auto& existing{ container.find(header) };
+				if (existing == container.end()) {
+					if constexpr (MOVE) container.emplace(header, std::move(section));
+					else container.emplace(header, section);
+					continue;
+				}
+
+				auto& existingSection{ existing->second };
+				if (maskRemovesExisting) {
+					std::erase_if(existingSection, [&section](auto&& item) {
+						return !section.contains(item.first);
+					});
+				}
+				for (auto& [key, value] : section) {
+					if (const auto& it{ existingSection.find(key) }; it != existingSection.end()) {
+						if constexpr (MOVE) merge_value(it->second, std::move(value), overrideStyle, header, key);
+						else merge_value(it->second, value, overrideStyle, header, key);
+					}
+					else if constexpr (MOVE) existingSection.emplace(key, std::move(value));
+					else existingSection.emplace(key, value);
+				}
+			}
+		}
+	}
+
 	/**
 	 * @brief					Performs a recursive merge of two given INI containers.
 	 * @param container			Input container reference.
@@ -621,155 +1043,540 @@ namespace ini {
 	template<class TKeyComparator = CaseInsensitiveCompare>
 	ini_container<TKeyComparator>& deep_merge(ini_container<TKeyComparator>& container, ini_container<TKeyComparator> const& other, OverrideStyle const& overrideStyle = OverrideStyle::Override)
 	{
-		for (const auto& [header, section] : other) {
-			if (const auto& existing{ container.find(header) }; existing != container.end()) {
-				auto& [existingHeader, existingSection] { *existing };
-				for (const auto& [key, value] : section) {
-					if (existingSection.contains(key)) {
-						switch (overrideStyle) {
-						case OverrideStyle::OnlyBlank:
-							if (!section.at(key).empty())
-								break; //< break if current value is NOT empty
-							else [[fallthrough]];
-						case OverrideStyle::Override:
-							existingSection.at(key) = value;
-							break;
-						case OverrideStyle::Throw:
-							throw ex::make_custom_exception<ini_key_exception>("Duplicate keys aren't allowed; '", header, (header.empty() ? "" : "::"), key, "' already has value '", section.at(key), "'! (Incoming value: '", value, "')");
-						case OverrideStyle::Skip: [[fallthrough]];
-						default:break;
-						}
-					}
-					else existingSection[key] = value;
-				}
-			}
-			else container.insert(std::make_pair(header, section));
-		}
+		_internal::merge_into(container, other, overrideStyle, false);
+		return container;
+	}
+	/**
+	 * @brief					Performs a recursive merge of two given INI containers, moving the sections & values from other rather than copying them.
+	 * @param container			Input container reference.
+	 * @param other				Other container rvalue reference.
+	 * @param overrideStyle		The header/key override style to use for duplicate headers/keys.
+	 * @returns					The reference of the container parameter, with all of the sections from other merged into it.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	ini_container<TKeyComparator>& deep_merge(ini_container<TKeyComparator>& container, ini_container<TKeyComparator>&& other, OverrideStyle const& overrideStyle = OverrideStyle::Override)
+	{
+		_internal::merge_into(container, std::move(other), overrideStyle, false);
 		return container;
 	}
 #pragma endregion deep_merge
 
-#pragma region parse
+#pragma region diff
 	/**
-	 * @brief							Parses the given input stream into an INI container object.
-	 * @param is						An input stream to parse data from.
-	 * @param config					Optional configuration object that changes the behaviour of the parser.
-	 * @returns							An ini_container type that contains all headers, keys, and values from the input stream.
-	 * @throws ini_syntax_exception		Input stream contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
-	 * @throws ini_key_exception		Input stream contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 * @enum	ChangeType
+	 * @brief	Describes how a key changed between two INI containers.
+	 */
+	enum class ChangeType : unsigned char {
+		/// @brief	The key didn't exist before, and now it does.
+		Added,
+		/// @brief	The key existed before, and now it doesn't.
+		Removed,
+		/// @brief	The key exists in both, but its value changed.
+		Changed,
+	};
+
+	/**
+	 * @struct	ini_change
+	 * @brief	Describes a change to a single header::key entry.
+	 */
+	struct ini_change {
+		/// @brief	How the key changed.
+		ChangeType type;
+		/// @brief	The name of the key's header.
+		std::string header;
+		/// @brief	The name of the key.
+		std::string key;
+		/// @brief	The previous value of the key. This is blank when type is ChangeType::Added.
+		std::string oldValue;
+		/// @brief	The new value of the key. This is blank when type is ChangeType::Removed.
+		std::string newValue;
+	};
+
+	/// @brief	A list of changes between two INI containers.
+	using ini_diff = std::vector<ini_change>;
+
+	/**
+	 * @brief			Compares two INI containers and lists the keys that were added, removed, or changed.
+	 * @param before	The original container.
+	 * @param after		The modified container.
+	 * @returns			An ini_diff that transforms before into after when passed to apply().
 	 */
 	template<class TKeyComparator = CaseInsensitiveCompare>
-	INLINE ini_container<TKeyComparator> parse(std::istream& is, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	ini_diff diff(ini_container<TKeyComparator> const& before, ini_container<TKeyComparator> const& after)
+	{
+		ini_diff changes;
+		for (const auto& [header, section] : before) {
+			const auto& afterSection{ after.find(header) };
+			for (const auto& [key, value] : section) {
+				if (afterSection == after.end() || !afterSection->second.contains(key))
+					changes.push_back({ ChangeType::Removed, header, key, value, {} });
+				else if (const auto& afterValue{ afterSection->second.find(key)->second }; afterValue != value)
+					changes.push_back({ ChangeType::Changed, header, key, value, afterValue });
+			}
+		}
+		for (const auto& [header, section] : after) {
+			const auto& beforeSection{ before.find(header) };
+			for (const auto& [key, value] : section) {
+				if (beforeSection == before.end() || !beforeSection->second.contains(key))
+					changes.push_back({ ChangeType::Added, header, key, {}, value });
+			}
+		}
+		return changes;
+	}
+	/**
+	 * @brief			Applies a list of changes to the given INI container in-place.
+	 *\n				Sections are removed when their last key is removed.
+	 * @param container	The container to modify.
+	 * @param changes	The changes to apply, usually from diff().
+	 * @returns			The reference of the container parameter.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	ini_container<TKeyComparator>& apply(ini_container<TKeyComparator>& container, ini_diff const& changes)
 	{
-		static const auto WHITESPACE{ " \t\v\r\n" };
+		for (const auto& change : changes) {
+			if (change.type == ChangeType::Removed) {
+				if (const auto& section{ container.find(change.header) }; section != container.end()) {
+					_internal::erase_key(section->second, change.key);
+					if (section->second.empty())
+						container.erase(section);
+				}
+			}
+			else _internal::find_or_insert(_internal::find_or_insert(container, change.header), change.key) = change.newValue;
+		}
+		return container;
+	}
+#pragma endregion diff
 
-		ini_container<TKeyComparator> ini{};
+#pragma region parse
+	/**
+	 * @enum	ParseErrorType
+	 * @brief	The categories of errors that can be reported to an event handler's on_error method.
+	 */
+	enum class ParseErrorType : unsigned char {
+		/// @brief	The line contains invalid syntax. These are only reported when the config's syntaxErrorStyle is SyntaxErrorStyle::Throw.
+		Syntax,
+		/// @brief	The line contains a header or key that isn't included by the mask. These are only reported when the config's maskStyle is MaskStyle::Throw.
+		Mask,
+	};
+	/**
+	 * @struct	ini_parse_error
+	 * @brief	Describes an error that was encountered by parse_events().
+	 */
+	struct ini_parse_error {
+		/// @brief	The category of error.
+		ParseErrorType type;
+		/// @brief	The index of the line that the error occurred on.
+		size_t line;
+		/// @brief	The error message; this is the same message that the equivalent exception would have.
+		std::string message;
+	};
 
-		size_t ln{ 0 };
+	namespace _internal {
+		/// @brief	The whitespace characters that are ignored around headers, keys, and values.
+		inline constexpr std::string_view INI_WHITESPACE{ " \t\v\r\n" };
 
-		std::string header{};
-		bool skip_header{ false };
+		/// @returns	A view of the given string_view without any preceding or trailing INI_WHITESPACE characters.
+		CONSTEXPR std::string_view trim(std::string_view const& sv) noexcept
+		{
+			const auto& fst{ sv.find_first_not_of(INI_WHITESPACE) };
+			if (fst == std::string_view::npos)
+				return sv.substr(sv.size());
+			return sv.substr(fst, sv.find_last_not_of(INI_WHITESPACE) - fst + 1);
+		}
 
-		for (std::string line; std::getline(is, line, '\n'); is.clear(), ++ln) {
-			if (std::all_of(line.begin(), line.end(), str::stdpred::isspace)) continue;
+		/**
+		 * @struct	char_classes
+		 * @brief	A 256-entry lookup table of the character classes used by the tokenizer, built once per parse from the parser config.
+		 */
+		struct char_classes {
+			enum : uint8_t {
+				/// @brief	Characters accepted by std::isspace in the "C" locale; lines & ranges made entirely of these are blank.
+				Blank = 1,
+				/// @brief	Characters in INI_WHITESPACE; these are trimmed from headers, keys, and values.
+				Whitespace = 2,
+				/// @brief	Characters in the config's escapeChars.
+				Escape = 4,
+				/// @brief	Characters in the config's commentChars.
+				Comment = 8,
+				/// @brief	Single & double quotation marks.
+				Quote = 16,
+			};
+
+			std::array<uint8_t, 256> table{};
+
+			template<class TKeyComparator>
+			explicit char_classes(ini_parser_config<TKeyComparator> const& config) noexcept
+			{
+				for (const char c : std::string_view{ " \t\n\v\f\r" })
+					table[$c(unsigned char, c)] |= Blank;
+				for (const char c : INI_WHITESPACE)
+					table[$c(unsigned char, c)] |= Whitespace;
+				for (const char c : config.escapeChars)
+					table[$c(unsigned char, c)] |= Escape;
+				for (const char c : config.commentChars)
+					table[$c(unsigned char, c)] |= Comment;
+				table[$c(unsigned char, '\'')] |= Quote;
+				table[$c(unsigned char, '\"')] |= Quote;
+			}
 
-			auto l{ config._$stripComments(line) };
+			/// @returns	The classes of the given character.
+			uint8_t operator[](const char c) const noexcept { return table[$c(unsigned char, c)]; }
 
-			if (std::all_of(l.begin(), l.end(), str::stdpred::isspace)) continue;
+			/// @returns	true when the given string_view is empty or contains only blank characters; otherwise false.
+			bool is_blank(std::string_view const& sv) const noexcept
+			{
+				return std::all_of(sv.begin(), sv.end(), [this](auto&& c) { return ((*this)[c] & Blank) != 0; });
+			}
+		};
 
-			// find headers
-			if (const size_t iOpen{ l.find($c(char, '[')) }, iClose{ l.rfind($c(char, ']')) };
-				iOpen != std::string::npos && iClose != std::string::npos) {
-				std::string tmpHeader{ l.substr(iOpen + 1, iClose - iOpen - 1) };
+		/**
+		 * @struct	line_scan
+		 * @brief	The positions of the structural characters in a line, collected by scan_line().
+		 */
+		struct line_scan {
+			static constexpr size_t npos{ std::string_view::npos };
+
+			/// @brief	The line, excluding any comment.
+			std::string_view l;
+			/// @brief	true when l contains only blank characters.
+			bool blank{ true };
+			/// @brief	The positions of the first & last non-whitespace characters in l.
+			size_t fstNonSpace{ npos }, lastNonSpace{ npos };
+			/// @brief	The position of the first '[', the last ']', and the first '=' in l.
+			size_t open{ npos }, close{ npos }, equals{ npos };
+			/// @brief	The positions of the first two double & single quotes after the first '=' that aren't preceded by an escape character.
+			std::array<size_t, 2> doubleQuotes{ npos, npos }, singleQuotes{ npos, npos };
+		};
 
-				if (config.stripWhitespaceFromHeaders)
-					tmpHeader = str::trim(tmpHeader);
+		/**
+		 * @brief			Scans a line once, removing any comment & locating all of the structural characters that the tokenizer needs.
+		 *\n				Comments start at the first comment character that isn't escaped or within quotes.
+		 * @param line		The line to scan.
+		 * @param classes	The character class table for the parser config.
+		 * @returns			A line_scan instance describing the line.
+		 */
+		inline line_scan scan_line(std::string_view const& line, char_classes const& classes) noexcept
+		{
+			line_scan scan;
+			bool escaped{ false }, single_quoted{ false }, double_quoted{ false };
+			size_t i{ 0 };
 
-				if (const size_t fstNonSpace{ l.find_first_not_of(WHITESPACE) }, lastNonSpace{ l.find_last_not_of(WHITESPACE) };
-					(iOpen > fstNonSpace || iClose < lastNonSpace) && config.syntaxErrorStyle == SyntaxErrorStyle::Throw)
-					throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " contains a header with preceding or trailing non-whitespace characters! '", line, "'");
+			for (const size_t end{ line.size() }; i < end; ++i) {
+				const char c{ line[i] };
+				const uint8_t cls{ classes[c] };
 
-				skip_header = false;
+				// comment stripping state
+				if (escaped)
+					escaped = false;
+				else if (cls & char_classes::Escape)
+					escaped = true;
+				else if (c == '\'')
+					single_quoted = !single_quoted;
+				else if (c == '\"')
+					double_quoted = !double_quoted;
+				else if (!single_quoted && !double_quoted && (cls & char_classes::Comment))
+					break;
+
+				if (!(cls & char_classes::Blank))
+					scan.blank = false;
+				if (!(cls & char_classes::Whitespace)) {
+					if (scan.fstNonSpace == line_scan::npos)
+						scan.fstNonSpace = i;
+					scan.lastNonSpace = i;
+				}
 
-				if (!config._$maskIncludes(tmpHeader)) {
-					switch (config.maskStyle) {
-					case MaskStyle::Skip:
-						skip_header = true;
-						break;
-					case MaskStyle::Throw:
-						throw ex::make_custom_exception<ini_mask_exception>("Line ", ln, " contains an unexpected header: '", tmpHeader, "'!");
-					case MaskStyle::Disable: [[fallthrough]];
-					default:break;
+				switch (c) {
+				case '[':
+					if (scan.open == line_scan::npos)
+						scan.open = i;
+					break;
+				case ']':
+					scan.close = i;
+					break;
+				case '=':
+					if (scan.equals == line_scan::npos)
+						scan.equals = i;
+					break;
+				case '\"': [[fallthrough]];
+				case '\'':
+					if (scan.equals != line_scan::npos && !(classes[line[i - 1]] & char_classes::Escape)) {
+						auto& quotes{ c == '\"' ? scan.doubleQuotes : scan.singleQuotes };
+						if (quotes[0] == line_scan::npos)
+							quotes[0] = i;
+						else if (quotes[1] == line_scan::npos)
+							quotes[1] = i;
 					}
+					break;
+				default:break;
+				}
+			}
+
+			scan.l = line.substr(0ull, i);
+			return scan;
+		}
+
+		/**
+		 * @brief			Finds the enclosing quotes of a value using the quote positions collected by scan_line().
+		 *\n				The first matching pair of unescaped double quotes is preferred, followed by the first pair of unescaped single quotes.
+		 * @param scan		The scan of the line that contains the value.
+		 * @param value		The value, which must be a view into scan.l that starts after scan.equals.
+		 * @returns			A pair of positions in value of the opening & closing quotes, or { npos, npos } if there aren't any valid enclosing quotes.
+		 */
+		inline std::pair<size_t, size_t> find_enclosing_quotes(line_scan const& scan, std::string_view const& value) noexcept
+		{
+			const size_t valueStart{ $c(size_t, value.data() - scan.l.data()) };
+
+			for (const auto& [quotes, delim] : { std::pair{ &scan.doubleQuotes, '\"' }, std::pair{ &scan.singleQuotes, '\'' } }) {
+				size_t fst{ (*quotes)[0] }, snd{ (*quotes)[1] };
+				// a quote at the beginning of the value is never considered escaped
+				if (!value.empty() && value.front() == delim && fst != valueStart) {
+					snd = fst;
+					fst = valueStart;
 				}
+				if (snd != line_scan::npos && snd < valueStart + value.size())
+					return{ fst - valueStart, snd - valueStart };
+			}
+			return{ line_scan::npos, line_scan::npos };
+		}
 
-				header = tmpHeader;
+		/// @returns	true when the given event's return value requests that parsing continues; events that return void always continue.
+		template<class TEvent>
+		INLINE bool invoke_event(TEvent&& event)
+		{
+			if constexpr (std::is_void_v<std::invoke_result_t<TEvent>>) {
+				event();
+				return true;
 			}
-			else if (!skip_header) {
-				// find key-value pairs
-				if (const size_t equals{ l.find('=') }; equals != std::string::npos) {
-					if (const std::string key{ str::trim(l.substr(0ull, equals)) }; !key.empty()) {
-						auto& section{ ini[header] };
-
-						std::string value{ l.substr(equals + 1) };
-
-						if (config.stripWhitespaceFromValue)
-							value = str::trim(value); //< remove unenclosed preceding/trailing whitespace
-
-						// find enclosing quotes
-						if (const auto& [fst, snd] { config._$findEnclosingQuotes(value) };
-							fst != value.end() && snd != value.end()) {
-							// validate the line if syntax errors are enabled
-							if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw) {
-								if (fst != value.begin() && !std::all_of<typename std::string::const_iterator>(value.begin(), fst, str::stdpred::isspace))
-									throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters before the opening quote: {", std::string_view{ value.begin(), fst }, "}!");
-								else if (snd != value.end() && !std::all_of<typename std::string::const_iterator>(snd + 1, value.end(), str::stdpred::isspace))
-									throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters after the closing quote: {", std::string_view{ snd + 1, value.end() }, "}!");
-							}
+			else return static_cast<bool>(event());
+		}
+
+		/**
+		 * @brief				Reports a parsing error to the handler's on_error event, or throws an exception if it doesn't have one.
+		 * @param handler		The event handler.
+		 * @param type			The category of error that occurred.
+		 * @param ln			The line index that the error occurred on.
+		 * @param message		The components of the error message.
+		 * @returns				true when parsing should continue; otherwise false.
+		 */
+		template<std::derived_from<ex::except> TException, class THandler, var::streamable<std::stringstream>... Ts>
+		bool raise_error(THandler& handler, ParseErrorType const& type, size_t const ln, Ts&&... message) noexcept(false)
+		{
+			if constexpr (requires(ini_parse_error const& e) { handler.on_error(e); })
+				return invoke_event([&] { return handler.on_error(ini_parse_error{ type, ln, str::stringify(std::forward<Ts>(message)...) }); });
+			else throw ex::make_custom_exception<TException>(std::forward<Ts>(message)...);
+		}
+
+		/**
+		 * @struct			line_tokenizer
+		 * @brief			Tokenizes INI data one line at a time, and forwards the results to an event handler.
+		 *\n				The handler may define any of the following methods; the ones that return bool can stop or filter the parser by returning false:
+		 *\n				- on_header(std::string_view header, size_t ln)							  | Returning false skips the keys in this section.
+		 *\n				- on_key_value(std::string_view header, key, value, size_t ln)			  | Returning false stops parsing. Callables that accept these parameters are also accepted.
+		 *\n				- on_error(ini_parse_error const& error)									  | Returning false stops parsing. When this is missing, errors are thrown instead.
+		 * @tparam THeader	The type used to store the current header between lines. This must own its data when lines don't outlive the tokenizer.
+		 */
+		template<class TKeyComparator, class THeader = std::string_view>
+		struct line_tokenizer {
+			ini_parser_config<TKeyComparator> const& config;
+			char_classes classes;
+			THeader header{};
+			bool skip_header{ false };
+
+			line_tokenizer(ini_parser_config<TKeyComparator> const& config) : config{ config }, classes{ config } {}
+
+			/**
+			 * @brief			Tokenizes a single line.
+			 * @param line		The line to tokenize, not including the line break.
+			 * @param ln		The index of the line.
+			 * @param handler	The event handler.
+			 * @returns			false when the handler requested that parsing stops; otherwise true.
+			 */
+			template<class THandler>
+			bool operator()(std::string_view const& line, size_t const ln, THandler& handler) noexcept(false)
+			{
+				const line_scan scan{ scan_line(line, classes) };
+				const std::string_view& l{ scan.l };
+
+				if (scan.blank) return true;
+
+				// find headers
+				if (const size_t iOpen{ scan.open }, iClose{ scan.close };
+					iOpen != std::string_view::npos && iClose != std::string_view::npos) {
+					std::string_view tmpHeader{ l.substr(iOpen + 1, iClose - iOpen - 1) };
+
+					if (config.stripWhitespaceFromHeaders)
+						tmpHeader = trim(tmpHeader);
+
+					if (const size_t fstNonSpace{ scan.fstNonSpace }, lastNonSpace{ scan.lastNonSpace };
+						(iOpen > fstNonSpace || iClose < lastNonSpace) && config.syntaxErrorStyle == SyntaxErrorStyle::Throw) {
+						skip_header = true; //< only reached when the handler handles errors
+						return raise_error<ini_syntax_exception>(handler, ParseErrorType::Syntax, ln, "Line ", ln, " contains a header with preceding or trailing non-whitespace characters! '", line, "'");
+					}
 
-							// update the value; optionally include quotes when the config enables it
-							value = { fst + config.stripEnclosingQuotes, snd + !config.stripEnclosingQuotes };
+					skip_header = false;
+					header = tmpHeader;
+
+					if (!config._$maskIncludes(tmpHeader)) {
+						switch (config.maskStyle) {
+						case MaskStyle::Skip:
+							skip_header = true;
+							return true;
+						case MaskStyle::Throw:
+							skip_header = true;
+							return raise_error<ini_mask_exception>(handler, ParseErrorType::Mask, ln, "Line ", ln, " contains an unexpected header: '", tmpHeader, "'!");
+						case MaskStyle::Disable: [[fallthrough]];
+						default:break;
 						}
+					}
 
-						if (!config._$maskIncludes(header, key)) {
-							switch (config.maskStyle) {
-							case MaskStyle::Skip:
-								continue; //< skip key
-							case MaskStyle::Throw:
-								throw ex::make_custom_exception<ini_mask_exception>("Line ", ln, " contains unexpected key '", key, "'", (header.empty() ? std::string{ " within section '" + header + "'!" } : "!"));
-							case MaskStyle::Disable: [[fallthrough]];
-							default: break;
+					if constexpr (requires { handler.on_header(tmpHeader, ln); })
+						skip_header = !invoke_event([&] { return handler.on_header(tmpHeader, ln); });
+				}
+				else if (!skip_header) {
+					// find key-value pairs
+					if (const size_t equals{ scan.equals }; equals != std::string_view::npos) {
+						if (const std::string_view key{ trim(l.substr(0ull, equals)) }; !key.empty()) {
+							std::string_view value{ l.substr(equals + 1) };
+
+							if (config.stripWhitespaceFromValue)
+								value = trim(value); //< remove unenclosed preceding/trailing whitespace
+
+							// find enclosing quotes
+							if (const auto& [fst, snd] { find_enclosing_quotes(scan, value) };
+								fst != std::string_view::npos && snd != std::string_view::npos) {
+								// validate the line if syntax errors are enabled
+								if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw) {
+									if (fst != 0 && !classes.is_blank(value.substr(0ull, fst)))
+										return raise_error<ini_syntax_exception>(handler, ParseErrorType::Syntax, ln, "Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters before the opening quote: {", value.substr(0ull, fst), "}!");
+									else if (!classes.is_blank(value.substr(snd + 1)))
+										return raise_error<ini_syntax_exception>(handler, ParseErrorType::Syntax, ln, "Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters after the closing quote: {", value.substr(snd + 1), "}!");
+								}
+
+								// update the value; optionally include quotes when the config enables it
+								value = value.substr(fst + config.stripEnclosingQuotes, snd + !config.stripEnclosingQuotes - fst - config.stripEnclosingQuotes);
 							}
-						}
 
-						if (section.contains(key)) {
-							switch (config.overrideStyle) {
-							case OverrideStyle::OnlyBlank:
-								if (!section.at(key).empty())
-									break; //< break if current value is NOT empty
-								else [[fallthrough]];
-							case OverrideStyle::Override:
-								section.at(key) = value;
-								break;
-							case OverrideStyle::Throw:
-								throw ex::make_custom_exception<ini_key_exception>("Line ", ln, " specifies a duplicate key '", value, "'; '", header, (header.empty() ? "" : "::"), key, "' already has value '", section.at(key), "'!");
-							case OverrideStyle::Skip: [[fallthrough]];
-							default:break;
+							const std::string_view headerView{ header };
+
+							if (!config._$maskIncludes(headerView, key)) {
+								switch (config.maskStyle) {
+								case MaskStyle::Skip:
+									return true; //< skip key
+								case MaskStyle::Throw:
+									return raise_error<ini_mask_exception>(handler, ParseErrorType::Mask, ln, "Line ", ln, " contains unexpected key '", key, "'", (headerView.empty() ? "!" : std::string{ " within section '" }.append(headerView).append("'!")));
+								case MaskStyle::Disable: [[fallthrough]];
+								default: break;
+								}
 							}
+
+							if constexpr (requires { handler.on_key_value(headerView, key, value, ln); })
+								return invoke_event([&] { return handler.on_key_value(headerView, key, value, ln); });
+							else if constexpr (std::invocable<THandler&, std::string_view, std::string_view, std::string_view, size_t>)
+								return invoke_event([&] { return handler(headerView, key, value, ln); });
 						}
-						else section.insert(std::make_pair(key, value));
+						else if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw)
+							return raise_error<ini_syntax_exception>(handler, ParseErrorType::Syntax, ln, "Invalid key specified on line ", ln, ": \"", line, '\"');
 					}
-					else if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw)
-						throw ex::make_custom_exception<ini_syntax_exception>("Invalid key specified on line ", ln, ": \"", line, '\"');
 				}
+				return true;
 			}
-		}
+		};
 
-		if (config.addMaskToOutput)
-			deep_merge<TKeyComparator>(ini, config.mask, OverrideStyle::OnlyBlank);
+		/**
+		 * @brief				Tokenizes a contiguous buffer of INI data without copying any of it.
+		 * @param buffer		The INI data to tokenize.
+		 * @param config		The parser configuration to use.
+		 * @param handler		An event handler accepted by line_tokenizer, or a function that is called with (header, key, value, line) for each key-value pair that is included by the mask.
+		 *\n					All of the string_views passed to it point into buffer, with the exception of the header view which is empty for the global section.
+		 */
+		template<class TKeyComparator, class THandler>
+		void tokenize(std::string_view const& buffer, ini_parser_config<TKeyComparator> const& config, THandler&& handler) noexcept(false)
+		{
+			line_tokenizer<TKeyComparator> tokenizer{ config };
+
+			for (size_t ln{ 0 }, pos{ 0 }, end{ buffer.size() }; pos < end; ++ln) {
+				const size_t eol{ std::min(buffer.find('\n', pos), end) };
+				if (!tokenizer(buffer.substr(pos, eol - pos), ln, handler))
+					return;
+				pos = eol + 1;
+			}
+		}
+
+		/**
+		 * @brief					Inserts a key-value pair into the given section, handling duplicate keys according to the given OverrideStyle.
+		 * @param section			The section to insert the key into.
+		 * @param key				The name of the key.
+		 * @param value				The value of the key.
+		 * @param overrideStyle		Determines how to handle keys that already exist in the section.
+		 * @param header			The name of the section's header; used for error messages.
+		 * @param ln				The line number that the key-value pair appears on; used for error messages.
+		 */
+		template<class TSection>
+		void insert_key(TSection& section, typename TSection::key_type&& key, typename TSection::mapped_type&& value, OverrideStyle const& overrideStyle, std::string_view const& header, size_t const ln) noexcept(false)
+		{
+			if (auto&& [existing, inserted] { section.try_emplace(std::move(key), std::move(value)) }; !inserted) {
+				switch (overrideStyle) {
+				case OverrideStyle::OnlyBlank:
+					if (!existing->second.empty())
+						break; //< break if current value is NOT empty
+					else [[fallthrough]];
+				case OverrideStyle::Override:
+					existing->second = std::move(value);
+					break;
+				case OverrideStyle::Throw:
+					throw ex::make_custom_exception<ini_key_exception>("Line ", ln, " specifies a duplicate key '", value, "'; '", header, (header.empty() ? "" : "::"), existing->first, "' already has value '", existing->second, "'!");
+				case OverrideStyle::Skip: [[fallthrough]];
+				default:break;
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief							Parses a contiguous buffer of INI data into an INI container object.
+	 *\n								The buffer is tokenized in-place; strings are only allocated for the headers, keys, and values stored in the result.
+	 * @param buffer					A view of the INI data to parse.
+	 * @param config					Optional configuration object that changes the behaviour of the parser.
+	 * @returns							An ini_container type that contains all headers, keys, and values from the buffer.
+	 * @throws ini_syntax_exception		Buffer contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		Buffer contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_container<TKeyComparator> parse(std::string_view const& buffer, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		ini_container<TKeyComparator> ini{};
+
+		// consecutive keys share the same header view, so only look up the section when it changes
+		std::string_view currentHeader{};
+		ini_section<TKeyComparator>* section{ nullptr };
+
+		_internal::tokenize(buffer, config, [&](std::string_view const& header, std::string_view const& key, std::string_view const& value, size_t const ln) {
+			if (section == nullptr || header.data() != currentHeader.data() || header.size() != currentHeader.size()) {
+				currentHeader = header;
+				section = &_internal::find_or_insert(ini, header);
+			}
+			_internal::insert_key(*section, std::string{ key }, ini_value{ std::string{ value } }, config.overrideStyle, header, ln);
+		});
+
+		if (config.addMaskToOutput)
+			deep_merge<TKeyComparator>(ini, config.mask, OverrideStyle::OnlyBlank);
 
 		return ini;
 	}
+	/**
+	 * @brief							Parses the given input stream into an INI container object.
+	 * @param is						An input stream to parse data from.
+	 * @param config					Optional configuration object that changes the behaviour of the parser.
+	 * @returns							An ini_container type that contains all headers, keys, and values from the input stream.
+	 * @throws ini_syntax_exception		Input stream contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		Input stream contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_container<TKeyComparator> parse(std::istream& is, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		const std::string buffer{ std::istreambuf_iterator<char>{ is }, std::istreambuf_iterator<char>{} };
+		return parse<TKeyComparator>(std::string_view{ buffer }, config);
+	}
 	/**
 	 * @brief							Parses the given input stream rvalue into an INI container object.
 	 * @param is						The rvalue reference of an input stream to parse data from.
@@ -783,44 +1590,323 @@ namespace ini {
 	{
 		return parse<TKeyComparator>(is, config);
 	}
+	/**
+	 * @brief							Parses a contiguous buffer of INI data, and calls the given handler's event methods instead of building a container.
+	 *\n								The handler may define any of the following methods; the ones that return bool can stop or filter the parser by returning false:
+	 *\n								- on_header(std::string_view header, size_t ln)			| Called for each header included by the mask. Returning false skips the keys in this section.
+	 *\n								- on_key_value(std::string_view header, key, value, ln)	| Called for each key included by the mask. Returning false stops parsing.
+	 *\n								- on_error(ini_parse_error const& error)					| Called instead of throwing exceptions. The invalid line is skipped, along with the section of an invalid header. Returning false stops parsing.
+	 *\n								Duplicate keys are passed to the handler as they appear, so the config's overrideStyle & addMaskToOutput properties are ignored.
+	 * @param buffer					A view of the INI data to parse. All of the string_views passed to the handler point into this buffer.
+	 * @param handler					An event handler object.
+	 * @param config					Optional configuration object that changes the behaviour of the parser.
+	 * @throws ini_syntax_exception		Buffer contains invalid syntax, the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw, and the handler doesn't have an on_error method.
+	 * @throws ini_mask_exception		Buffer contains a header or key that isn't included by the mask, the maskStyle specified by the config was MaskStyle::Throw, and the handler doesn't have an on_error method.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare, class THandler>
+	INLINE void parse_events(std::string_view const& buffer, THandler&& handler, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		_internal::tokenize(buffer, config, handler);
+	}
+	/**
+	 * @brief							Parses the given input stream one line at a time, and calls the given handler's event methods instead of building a container.
+	 *\n								Only the current line & header are kept in memory, so this can be used to filter or forward arbitrarily large INI data.
+	 *\n								See the string_view overload for a description of the handler's event methods.
+	 * @param is						An input stream to parse data from.
+	 * @param handler					An event handler object. The string_views passed to it are only valid until the event returns.
+	 * @param config					Optional configuration object that changes the behaviour of the parser.
+	 * @throws ini_syntax_exception		Input stream contains invalid syntax, the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw, and the handler doesn't have an on_error method.
+	 * @throws ini_mask_exception		Input stream contains a header or key that isn't included by the mask, the maskStyle specified by the config was MaskStyle::Throw, and the handler doesn't have an on_error method.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare, class THandler>
+	INLINE void parse_events(std::istream& is, THandler&& handler, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		_internal::line_tokenizer<TKeyComparator, std::string> tokenizer{ config };
+
+		std::string line;
+		for (size_t ln{ 0 }; std::getline(is, line); ++ln)
+			if (!tokenizer(line, ln, handler))
+				return;
+	}
+	/**
+	 * @brief							Parses a contiguous buffer of INI data into a non-owning INI container, without allocating any strings.
+	 *\n								The headers, keys, and values in the result are views into buffer, which must outlive it.
+	 *\n								Use materialize() to convert the result (or parts of it) into owned strings.
+	 * @param buffer					A view of the INI data to parse.
+	 * @param config					Optional configuration object that changes the behaviour of the parser. The addMaskToOutput property is ignored.
+	 * @returns							An ini_container_view type that references all headers, keys, and values in the buffer.
+	 * @throws ini_syntax_exception		Buffer contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		Buffer contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_container_view<TKeyComparator> parse_view(std::string_view const& buffer, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		ini_container_view<TKeyComparator> ini{};
+
+		_internal::tokenize(buffer, config, [&ini, &config](std::string_view const& header, std::string_view const& key, std::string_view const& value, size_t const ln) {
+			_internal::insert_key(ini[header], std::string_view{ key }, std::string_view{ value }, config.overrideStyle, header, ln);
+		});
+
+		return ini;
+	}
+	/**
+	 * @brief			Copies the given non-owning section into an owning ini_section.
+	 * @param section	A section returned by parse_view().
+	 * @returns			An ini_section containing copies of all of the keys & values in section.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_section<TKeyComparator> materialize(ini_section_view<TKeyComparator> const& section)
+	{
+		ini_section<TKeyComparator> out{};
+		out.reserve(section.size());
+		for (const auto& [key, value] : section)
+			out.emplace(std::string{ key }, ini_value{ std::string{ value } });
+		return out;
+	}
+	/**
+	 * @brief			Copies the given non-owning container into an owning ini_container.
+	 * @param ini		A container returned by parse_view().
+	 * @returns			An ini_container containing copies of all of the headers, keys & values in ini.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_container<TKeyComparator> materialize(ini_container_view<TKeyComparator> const& ini)
+	{
+		ini_container<TKeyComparator> out{};
+		out.reserve(ini.size());
+		for (const auto& [header, section] : ini)
+			out.emplace(std::string{ header }, materialize<TKeyComparator>(section));
+		return out;
+	}
+
+	namespace _internal {
+		/**
+		 * @brief			Reads & parses the specified INI file, if it exists. See parse_file().
+		 *\n				Whether the file exists is determined by the attempt to open it, so the file isn't queried separately beforehand.
+		 * @returns			The parsed contents of the file, or std::nullopt when it doesn't exist.
+		 */
+		template<class TKeyComparator>
+		INLINE std::optional<ini_container<TKeyComparator>> parse_file_if_exists(std::filesystem::path const& path, ini_parser_config<TKeyComparator> const& config, bool const mapFile) noexcept(false)
+		{
+			std::error_code ec;
+			if (mapFile) {
+				if (const file::mapped_file file{ path, ec, file::access_hint::Sequential }; !ec && !file.empty())
+					return parse<TKeyComparator>(file.view(), config);
+				else if (ec == std::errc::no_such_file_or_directory)
+					return std::nullopt;
+				// some special files (such as those in procfs) report a size of 0, so empty files are read normally
+				ec.clear();
+			}
+
+			std::string buffer;
+			file::read_into(path, buffer, ec);
+			if (ec == std::errc::no_such_file_or_directory)
+				return std::nullopt;
+			// other errors are treated as an empty file, the same as file::read_all()
+			return parse<TKeyComparator>(std::string_view{ buffer }, config);
+		}
+	}
+
+	/**
+	 * @brief							Reads & parses the specified INI file.
+	 *\n								The file is read into memory with a single read call, and files that don't exist are parsed as empty files.
+	 * @param path						The location of the file to parse.
+	 * @param config					Optional configuration object that changes the behaviour of the parser.
+	 * @param mapFile					When true, the file is mapped into memory & parsed in-place instead, so its contents are never copied.
+	 *\n								Only use this for files that can't be truncated by another process while they're being parsed; on POSIX systems, that raises SIGBUS.
+	 *\n								Files that can't be mapped (such as pipes) are read into memory regardless.
+	 * @returns							An ini_container type that contains all headers, keys, and values from the file.
+	 * @throws ini_syntax_exception		The file contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		The file contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE ini_container<TKeyComparator> parse_file(std::filesystem::path const& path, ini_parser_config<TKeyComparator> const& config = {}, bool const mapFile = false) noexcept(false)
+	{
+		return _internal::parse_file_if_exists<TKeyComparator>(path, config, mapFile).value_or(ini_container<TKeyComparator>{});
+	}
+	/**
+	 * @brief							Reads & parses multiple INI files concurrently using the given thread pool.
+	 *\n								Files that don't exist are parsed as empty files, the same as basic_ini::read().
+	 * @param paths						The locations of the files to parse.
+	 * @param config					Configuration object that changes the behaviour of the parser. This is shared between all of the files.
+	 * @param pool						The thread pool to parse the files on.
+	 * @returns							A vector of ini_container types, one for each path, in the same order as paths.
+	 * @throws ini_syntax_exception		A file contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		A file contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 *\n								When more than one file fails to parse, the exception from the first one in paths is thrown.
+	 * @throws ex::except				Called from a task running on pool; waiting for the files there could deadlock the pool.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE std::vector<ini_container<TKeyComparator>> parse_files(std::vector<std::filesystem::path> const& paths, ini_parser_config<TKeyComparator> const& config, shared::thread_pool& pool) noexcept(false)
+	{
+		if (pool.is_worker_thread())
+			throw make_exception("parse_files() cannot be called from a task running on the same thread pool!");
+
+		std::vector<std::future<ini_container<TKeyComparator>>> futures;
+		futures.reserve(paths.size());
+		for (const auto& path : paths) {
+			futures.emplace_back(pool.submit([&path, &config] {
+				return parse_file<TKeyComparator>(path, config);
+			}));
+		}
+
+		// wait for every task before retrieving the results, since they all reference paths & config
+		for (const auto& future : futures)
+			future.wait();
+
+		std::vector<ini_container<TKeyComparator>> results;
+		results.reserve(futures.size());
+		for (auto& future : futures)
+			results.emplace_back(future.get());
+		return results;
+	}
+	/**
+	 * @brief							Reads & parses multiple INI files concurrently, using a temporary thread pool with up to one thread per file.
+	 *\n								Files that don't exist are parsed as empty files, the same as basic_ini::read().
+	 * @param paths						The locations of the files to parse.
+	 * @param config					Optional configuration object that changes the behaviour of the parser. This is shared between all of the files.
+	 * @returns							A vector of ini_container types, one for each path, in the same order as paths.
+	 * @throws ini_syntax_exception		A file contains invalid syntax, and the syntaxErrorStyle specified by the config was SyntaxErrorStyle::Throw
+	 * @throws ini_key_exception		A file contains duplicate keys, and the overrideStyle specified by the config was OverrideStyle::Throw
+	 *\n								When more than one file fails to parse, the exception from the first one in paths is thrown.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	INLINE std::vector<ini_container<TKeyComparator>> parse_files(std::vector<std::filesystem::path> const& paths, ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		if (paths.empty())
+			return{};
+		shared::thread_pool pool{ std::min(paths.size(), shared::thread_pool::default_size()) };
+		return parse_files<TKeyComparator>(paths, config, pool);
+	}
 #pragma endregion parse
 
 #pragma region ini_printer
 	/**
 	 * @struct	ini_printer
 	 * @brief	Prints INI container objects to an output stream, with configurable formatting.
+	 *\n		The output is serialized into a single buffer that is sized in advance, then written to the stream all at once.
 	 */
 	template<class TKeyComparator = CaseInsensitiveCompare>
 	struct ini_printer {
 		using ostream_t = std::ostream;
 		using ini_t = ini_container<TKeyComparator>;
 
-		ini_t* ini{ nullptr };
+		const ini_t* ini{ nullptr };
 		bool explicitGlobalHeader{ false };
 		bool insertNewlineBetweenSections{ true };
+		/// @brief	When true, sections & keys are printed in lexicographical order so the output is stable & diffable; otherwise they're printed in the container's order.
+		bool sortOutput{ false };
 
-		ini_printer(ini_t* ini = nullptr) : ini{ ini } {}
+		ini_printer(const ini_t* ini = nullptr) : ini{ ini } {}
 
-		friend ostream_t& operator<<(ostream_t& os, const ini_printer& printer)
+	private:
+		using section_entry = typename ini_t::value_type;
+		using key_entry = typename ini_t::mapped_type::value_type;
+
+		static section_entry const& deref(section_entry const& entry) noexcept { return entry; }
+		static section_entry const& deref(const section_entry* entry) noexcept { return *entry; }
+
+		/// @returns	Pointers to the sections of ini, sorted by header.
+		std::vector<const section_entry*> sorted_sections() const
 		{
-			if (printer.ini != nullptr) {
-				bool fst{ true }, fstHeader{ true };
-				for (const auto& [header, section] : (*printer.ini)) {
-					if (printer.insertNewlineBetweenSections) {
-						if (fst) fst = false;
-						else os << '\n';
-					}
+			std::vector<const section_entry*> sections;
+			sections.reserve(ini->size());
+			for (const auto& entry : *ini)
+				sections.emplace_back(&entry);
+			std::sort(sections.begin(), sections.end(), [](auto&& l, auto&& r) { return l->first < r->first; });
+			return sections;
+		}
+
+		/// @returns	The exact number of characters that serialize() writes for the given range of sections.
+		template<class TRange>
+		size_t measure(TRange const& sections) const noexcept
+		{
+			size_t size{ 0 };
+			bool fst{ true };
+			for (const auto& entry : sections) {
+				const auto& [header, section] { deref(entry) };
+				if (insertNewlineBetweenSections && !fst)
+					++size;
+				if (!header.empty() || !fst || explicitGlobalHeader)
+					size += header.size() + 3; //< "[" header "]\n"
+				for (const auto& [key, value] : section)
+					size += key.size() + value.size() + 4; //< key " = " value "\n"
+				fst = false;
+			}
+			return size;
+		}
 
-					if (!header.empty() || !fstHeader || printer.explicitGlobalHeader)
-						os << $c(char, '[') << header << $c(char, ']') << '\n';
+		/// @brief	Writes the given range of sections to the buffer pointed to by out, which must have room for measure(sections) characters.
+		template<class TRange>
+		void serialize(TRange const& sections, char* out) const
+		{
+			const auto& put{ [&out](std::string_view const& sv) { out = std::copy(sv.begin(), sv.end(), out); } };
+			const auto& putKey{ [&](key_entry const& entry) {
+				put(entry.first);
+				put(" = ");
+				put(entry.second);
+				*out++ = '\n';
+			} };
 
-					for (const auto& [key, val] : section)
-						os << key << $c(char, ' ') << $c(char, '=') << $c(char, ' ') << val << '\n';
+			std::vector<const key_entry*> keys; //< only used when sorting
+			bool fst{ true };
+			for (const auto& entry : sections) {
+				const auto& [header, section] { deref(entry) };
+				if (insertNewlineBetweenSections && !fst)
+					*out++ = '\n';
+
+				if (!header.empty() || !fst || explicitGlobalHeader) {
+					*out++ = '[';
+					put(header);
+					*out++ = ']';
+					*out++ = '\n';
+				}
 
-					fstHeader = false;
+				if (sortOutput) {
+					keys.clear();
+					keys.reserve(section.size());
+					for (const auto& kv : section)
+						keys.emplace_back(&kv);
+					std::sort(keys.begin(), keys.end(), [](auto&& l, auto&& r) { return l->first < r->first; });
+					for (const auto* kv : keys)
+						putKey(*kv);
 				}
+				else for (const auto& kv : section)
+					putKey(kv);
+
+				fst = false;
 			}
-			return os;
+		}
+
+	public:
+		/// @returns	The number of characters in the printed output.
+		size_t size() const noexcept
+		{
+			return ini == nullptr ? 0ull : measure(*ini);
+		}
+
+		/// @returns	A string containing the printed output.
+		std::string str() const
+		{
+			std::string buffer;
+			if (ini == nullptr)
+				return buffer;
+
+			if (sortOutput) {
+				const auto& sections{ sorted_sections() };
+				buffer.resize(measure(sections));
+				serialize(sections, buffer.data());
+			}
+			else {
+				buffer.resize(measure(*ini));
+				serialize(*ini, buffer.data());
+			}
+			return buffer;
+		}
+
+		friend ostream_t& operator<<(ostream_t& os, const ini_printer& printer)
+		{
+			const auto& buffer{ printer.str() };
+			return os.write(buffer.data(), $c(std::streamsize, buffer.size()));
 		}
 	};
 #pragma endregion ini_printer
@@ -831,6 +1917,335 @@ namespace ini {
 	/// @brief	The global header.
 	inline constexpr const auto GLOBAL{ "" };
 
+#pragma region basic_frozen_ini
+	/**
+	 * @class	basic_frozen_ini
+	 * @brief	Immutable, contiguous snapshot of an INI container; see basic_ini::freeze().
+	 *\n		All of the headers, keys, and values are interned into a single string pool, and the
+	 *\n		 header & key tables are flat arrays sorted by hash, so lookups are a binary search
+	 *\n		 over contiguous memory instead of a walk through per-node heap allocations.
+	 *\n		Section views, iterators, and the string_views they return point into heap buffers that
+	 *\n		 are owned by the instance, so they stay valid when it is moved, but not after it is destroyed.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	class basic_frozen_ini {
+		using this_t = basic_frozen_ini<TKeyComparator>;
+		using container_t = ini_container<TKeyComparator>;
+		using hasher_t = ini_key_hasher_t<TKeyComparator>;
+
+		/// @brief	A range of characters within the string pool.
+		struct string_ref {
+			uint32_t offset;
+			uint32_t length;
+		};
+		/// @brief	A key-value pair.
+		struct key_entry {
+			size_t hash;
+			string_ref name;
+			string_ref value;
+		};
+		/// @brief	A header & the range of key_entry elements that belong to its section.
+		struct section_entry {
+			size_t hash;
+			string_ref name;
+			uint32_t first;
+			uint32_t count;
+		};
+
+		/**
+		 * @brief	Pointers to the string pool & key table.
+		 *\n		Views & iterators hold one of these instead of a pointer to the owning instance;
+		 *\n		 the buffers don't move when a vector is moved, so they survive moving the instance.
+		 */
+		struct storage_ref {
+			const char* pool{ nullptr };
+			const key_entry* keys{ nullptr };
+
+			/// @returns	A view of the given string_ref's characters in the pool.
+			std::string_view str(string_ref const& ref) const noexcept
+			{
+				return{ pool + ref.offset, ref.length };
+			}
+			/// @returns	A pointer to the element with the given name in the given hash-sorted range, or nullptr if it doesn't exist.
+			template<class TEntry>
+			const TEntry* find_entry(const TEntry* first, const TEntry* last, std::string_view const& name) const noexcept
+			{
+				const size_t hash{ hasher_t{}(name) };
+				for (auto it{ std::lower_bound(first, last, hash, [](TEntry const& e, size_t const h) { return e.hash < h; }) }; it != last && it->hash == hash; ++it) {
+					if (TKeyComparator{}(str(it->name), name))
+						return it;
+				}
+				return nullptr;
+			}
+		};
+
+		// std::vector<char> rather than std::string, because moving a short string copies its characters
+		std::vector<char> pool;
+		std::vector<section_entry> sections;
+		std::vector<key_entry> keys;
+
+		/// @returns	A storage_ref that points to this instance's buffers.
+		storage_ref storage() const noexcept { return{ pool.data(), keys.data() }; }
+		/// @returns	A view of the given string_ref's characters in the pool.
+		std::string_view str(string_ref const& ref) const noexcept { return storage().str(ref); }
+		/// @returns	A pointer to the element with the given name in the given hash-sorted range, or nullptr if it doesn't exist.
+		template<class TEntry>
+		const TEntry* find_entry(const TEntry* first, const TEntry* last, std::string_view const& name) const noexcept
+		{
+			return storage().find_entry(first, last, name);
+		}
+		/// @returns	A pointer to the given header's section entry, or nullptr if it doesn't exist.
+		const section_entry* find_section(std::string_view const& header) const noexcept
+		{
+			return find_entry(sections.data(), sections.data() + sections.size(), header);
+		}
+		/// @returns	A pointer to the given key's entry, or nullptr if it doesn't exist.
+		const key_entry* find_key(std::string_view const& header, std::string_view const& key) const noexcept
+		{
+			if (const auto* section{ find_section(header) })
+				return find_entry(keys.data() + section->first, keys.data() + section->first + section->count, key);
+			return nullptr;
+		}
+
+		/**
+		 * @brief	Forward iterator over a range of entries that dereferences to a (name, value) pair.
+		 * @tparam TEntry	Either section_entry or key_entry.
+		 */
+		template<class TEntry>
+		class entry_iterator {
+			storage_ref storage;
+			const TEntry* it{ nullptr };
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = decltype(this_t::deref(std::declval<const storage_ref&>(), std::declval<const TEntry&>()));
+
+			entry_iterator() = default;
+			entry_iterator(storage_ref const& storage, const TEntry* it) : storage{ storage }, it{ it } {}
+
+			value_type operator*() const { return this_t::deref(storage, *it); }
+			entry_iterator& operator++() { ++it; return *this; }
+			entry_iterator operator++(int) { auto copy{ *this }; ++it; return copy; }
+			bool operator==(entry_iterator const& o) const noexcept { return it == o.it; }
+		};
+
+	public:
+		/**
+		 * @class	section_view
+		 * @brief	Read-only view of a single section within a basic_frozen_ini.
+		 */
+		class section_view {
+			storage_ref storage;
+			const section_entry* section;
+
+		public:
+			using iterator = entry_iterator<key_entry>;
+			using const_iterator = iterator;
+
+			section_view(storage_ref const& storage, const section_entry* section) : storage{ storage }, section{ section } {}
+
+			/// @returns	The name of this section's header.
+			std::string_view header() const noexcept { return storage.str(section->name); }
+			/// @returns	The number of keys in this section.
+			size_t size() const noexcept { return section->count; }
+			/// @returns	true when this section doesn't contain any keys.
+			bool empty() const noexcept { return section->count == 0; }
+			/// @returns	An iterator to the beginning of the range of key-value pairs.
+			iterator begin() const noexcept { return{ storage, storage.keys + section->first }; }
+			/// @returns	An iterator to the end of the range of key-value pairs.
+			iterator end() const noexcept { return{ storage, storage.keys + section->first + section->count }; }
+			/// @returns	true when this section contains the specified key; otherwise false.
+			bool contains(std::string_view const& key) const noexcept { return find_key(key) != nullptr; }
+			/**
+			 * @brief		Gets the value of the specified key.
+			 * @param key	The name of the target key.
+			 * @returns		A view of the value of the specified key.
+			 * @throws		An out-of-range exception is thrown when the specified key doesn't exist.
+			 */
+			std::string_view at(std::string_view const& key) const noexcept(false)
+			{
+				if (const auto* entry{ find_key(key) })
+					return storage.str(entry->value);
+				throw std::out_of_range(std::string{ "Key '" }.append(key).append("' doesn't exist!"));
+			}
+
+		private:
+			const key_entry* find_key(std::string_view const& key) const noexcept
+			{
+				return storage.find_entry(storage.keys + section->first, storage.keys + section->first + section->count, key);
+			}
+		};
+
+		using iterator = entry_iterator<section_entry>;
+		using const_iterator = iterator;
+
+	private:
+		static std::pair<std::string_view, section_view> deref(storage_ref const& storage, section_entry const& e) { return{ storage.str(e.name), section_view{ storage, &e } }; }
+		static std::pair<std::string_view, std::string_view> deref(storage_ref const& storage, key_entry const& e) { return{ storage.str(e.name), storage.str(e.value) }; }
+
+	public:
+	#pragma region constructors
+		/// @brief	Default ctor
+		basic_frozen_ini() {}
+		/**
+		 * @brief		Freezing ctor. Copies the contents of the given container into a new frozen instance.
+		 * @param ini	The INI container to copy.
+		 * @throws		ex::except when the total length of all unique strings exceeds 4 GiB.
+		 */
+		explicit basic_frozen_ini(container_t const& ini) noexcept(false)
+		{
+			size_t keyCount{ 0 }, poolSize{ 0 };
+			for (const auto& [header, section] : ini) {
+				keyCount += section.size();
+				poolSize += header.size();
+				for (const auto& [key, value] : section)
+					poolSize += key.size() + value.size();
+			}
+			if (poolSize > std::numeric_limits<uint32_t>::max() || keyCount > std::numeric_limits<uint32_t>::max())
+				throw make_exception("Cannot freeze an INI container larger than 4 GiB!");
+
+			// identical strings (common values, keys repeated across sections, etc.) are only stored once
+			std::unordered_map<std::string_view, string_ref> interned;
+			const auto& intern{ [this, &interned](std::string_view const& s) -> string_ref {
+				if (const auto& [it, inserted] { interned.try_emplace(s) }; !inserted)
+					return it->second;
+				else {
+					it->second = { $c(uint32_t, pool.size()), $c(uint32_t, s.size()) };
+					pool.insert(pool.end(), s.begin(), s.end());
+					return it->second;
+				}
+			} };
+
+			pool.reserve(poolSize);
+			sections.reserve(ini.size());
+			keys.reserve(keyCount);
+
+			for (const auto& [header, section] : ini) {
+				const auto first{ $c(uint32_t, keys.size()) };
+				sections.push_back({ hasher_t{}(header), intern(header), first, $c(uint32_t, section.size()) });
+				for (const auto& [key, value] : section)
+					keys.push_back({ hasher_t{}(key), intern(key), intern(value) });
+				std::sort(keys.begin() + first, keys.end(), [](key_entry const& l, key_entry const& r) { return l.hash < r.hash; });
+			}
+			std::sort(sections.begin(), sections.end(), [](section_entry const& l, section_entry const& r) { return l.hash < r.hash; });
+
+			pool.shrink_to_fit();
+		}
+	#pragma endregion constructors
+
+	#pragma region map_methods
+		/// @returns	An iterator to the beginning of the range of headers & sections.
+		iterator begin() const noexcept { return{ storage(), sections.data() }; }
+		/// @returns	An iterator to the end of the range of headers & sections.
+		iterator end() const noexcept { return{ storage(), sections.data() + sections.size() }; }
+		/// @returns	The number of header-section pairs.
+		size_t size() const noexcept { return sections.size(); }
+		/// @returns	true when there are no header-section pairs.
+		bool empty() const noexcept { return sections.empty(); }
+		/// @returns	An iterator to the header-section pair with a matching header, or end() if it doesn't exist.
+		iterator find(std::string_view const& header) const noexcept
+		{
+			if (const auto* section{ find_section(header) })
+				return{ storage(), section };
+			return end();
+		}
+		/// @returns	true when this instance contains the specified header; otherwise false.
+		bool contains(std::string_view const& header) const noexcept { return find_section(header) != nullptr; }
+		/// @returns	true when this instance contains the specified header & key; otherwise false.
+		bool contains(std::string_view const& header, std::string_view const& key) const noexcept { return find_key(header, key) != nullptr; }
+		/// @returns	The total number of bytes used by the string pool & the header/key tables.
+		size_t memory_usage() const noexcept { return pool.capacity() + sections.capacity() * sizeof(section_entry) + keys.capacity() * sizeof(key_entry); }
+	#pragma endregion map_methods
+
+	#pragma region at
+		/**
+		 * @brief			Gets a view of the section with the given header.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @returns			A view of the section with the given header.
+		 * @throws			An out-of-range exception is thrown when the specified header doesn't exist.
+		 */
+		section_view at(std::string_view const& header) const noexcept(false)
+		{
+			if (const auto* section{ find_section(header) })
+				return{ storage(), section };
+			throw std::out_of_range(std::string{ "Key '" }.append(header).append("' doesn't exist!"));
+		}
+		/**
+		 * @brief			Gets a view of the value of a specified key.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param key		The name of the target key.
+		 * @returns			A view of the value of the specified key.
+		 * @throws			An out-of-range exception is thrown when the specified header or key doesn't exist.
+		 */
+		std::string_view at(std::string_view const& header, std::string_view const& key) const noexcept(false)
+		{
+			return at(header).at(key);
+		}
+	#pragma endregion at
+
+	#pragma region get
+		/**
+		 * @brief			Gets a view of the value of the specified key, without copying it.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param key		The name of the target key.
+		 * @returns			A view of the value of the specified key, or std::nullopt if the specified header or key doesn't exist.
+		 */
+		std::optional<std::string_view> get_view(std::string_view const& header, std::string_view const& key) const noexcept
+		{
+			if (const auto* entry{ find_key(header, key) })
+				return str(entry->value);
+			return std::nullopt;
+		}
+		/**
+		 * @brief			Gets the value of the specified key.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param key		The name of the target key.
+		 * @returns			The value of the specified key, or std::nullopt if the specified header or key doesn't exist.
+		 */
+		std::optional<ini_value> get(std::string_view const& header, std::string_view const& key) const noexcept
+		{
+			if (const auto* entry{ find_key(header, key) })
+				return ini_value{ std::string{ str(entry->value) } };
+			return std::nullopt;
+		}
+		/**
+		 * @brief					Gets the value of the specified key, or a default value if it doesn't exist.
+		 * @param header			The name of the target header. (Leave blank for global)
+		 * @param key				The name of the target key.
+		 * @param defaultValue		A default value or string that will be returned if the specified key doesn't exist.
+		 * @returns					The value of the specified key, or defaultValue if the specified header or key doesn't exist.
+		 */
+		ini_value get_or(std::string_view const& header, std::string_view const& key, ini_value const& defaultValue) const noexcept
+		{
+			return get(header, key).value_or(defaultValue);
+		}
+	#pragma endregion get
+
+	#pragma region check
+		/**
+		 * @brief			Checks if the specified key exists.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param key		The name of the target key.
+		 * @returns			true when the specified key exists; otherwise false.
+		 */
+		bool check(std::string_view const& header, std::string_view const& key) const noexcept { return contains(header, key); }
+		/**
+		 * @brief					Compares the current value of the specified key to the given expected_value.
+		 * @param header			The name of the target header. (Leave blank for global)
+		 * @param key				The name of the target key.
+		 * @param expected_value	The value to compare to the current value of the specified key.
+		 * @returns					true when the value of the specified key matches the expected_value; otherwise false. If the specified key doesn't exist, returns false.
+		 */
+		bool checkv(std::string_view const& header, std::string_view const& key, std::string_view const& expected_value) const noexcept
+		{
+			const auto& v{ get_view(header, key) };
+			return v.has_value() && v.value() == expected_value;
+		}
+	#pragma endregion check
+	};
+#pragma endregion basic_frozen_ini
+
 #pragma region basic_ini
 	/**
 	 * @class	basic_ini
@@ -883,7 +2298,7 @@ namespace ini {
 		 * @param throwIfFileNotFound	When true & the specified file doesn't exist, an exception is thrown; otherwise when false, the object is initialized as an empty instance.
 		 */
 		basic_ini(std::filesystem::path const& path, config_t const& config = {}, const bool throwIfFileNotFound = false)
-			: map([](auto&& path, auto&& config, auto&& throwIfFileNotFound) { if (file::exists(path)) return parse<TKeyComparator>(file::read(path, std::ios_base::binary), config); else if (throwIfFileNotFound) throw make_custom_exception<ini_file_not_found_exception>("File Not Found:  ", path); else return container_t{}; }(path, config, throwIfFileNotFound))
+			: map([](auto&& path, auto&& config, auto&& throwIfFileNotFound) { if (auto&& container{ _internal::parse_file_if_exists<TKeyComparator>(path, config, false) }) return std::move(*container); else if (throwIfFileNotFound) throw make_custom_exception<ini_file_not_found_exception>("File Not Found:  ", path); else return container_t{}; }(path, config, throwIfFileNotFound))
 		{}
 
 		basic_ini(std::initializer_list<std::pair<std::string, section_t>> sections)
@@ -898,35 +2313,13 @@ namespace ini {
 		/// @brief	See ::ini::deep_merge
 		this_t& deep_merge(container_t const& other, OverrideStyle const& overrideStyle = OverrideStyle::Override, bool maskRemovesExisting = false)
 		{
-			for (const auto& [header, section] : other) {
-				if (const auto& existing{ this->map.find(header) }; existing != this->map.end()) {
-					auto& [existingHeader, existingSection] { *existing };
-					if (maskRemovesExisting) {
-						std::erase_if(existingSection, [&section](auto&& item) {
-							return !section.contains(item.first);
-						});
-					}
-					for (const auto& [key, value] : section) {
-						if (existingSection.contains(key)) {
-							switch (overrideStyle) {
-							case OverrideStyle::OnlyBlank:
-								if (!section.at(key).empty())
-									break; //< break if current value is NOT empty
-								else [[fallthrough]];
-							case OverrideStyle::Override:
-								existingSection.at(key) = value;
-								break;
-							case OverrideStyle::Throw:
-								throw ex::make_custom_exception<ini_key_exception>("Duplicate keys aren't allowed; '", header, (header.empty() ? "" : "::"), key, "' already has value '", section.at(key), "'! (Incoming value: '", value, "')");
-							case OverrideStyle::Skip: [[fallthrough]];
-							default:break;
-							}
-						}
-						else existingSection[key] = value;
-					}
-				}
-				else this->map.insert(std::make_pair(header, section));
-			}
+			_internal::merge_into(this->map, other, overrideStyle, maskRemovesExisting);
+			return *this;
+		}
+		/// @brief	See ::ini::deep_merge
+		this_t& deep_merge(container_t&& other, OverrideStyle const& overrideStyle = OverrideStyle::Override, bool maskRemovesExisting = false)
+		{
+			_internal::merge_into(this->map, std::move(other), overrideStyle, maskRemovesExisting);
 			return *this;
 		}
 	#pragma endregion deep_merge
@@ -1005,7 +2398,7 @@ namespace ini {
 		 */
 		void read(std::filesystem::path const& path, ParserConfig const& config, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
 		{
-			this->deep_merge(parse<TKeyComparator>(file::read(path), config), overrideStyle);
+			this->deep_merge(parse_file<TKeyComparator>(path, config), overrideStyle);
 		}
 		/**
 		 * @brief					Reads the specified INI config file and merges its contents into this instance according to the given OverrideStyle.
@@ -1014,23 +2407,106 @@ namespace ini {
 		 */
 		void read(std::filesystem::path const& path, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
 		{
-			this->deep_merge(parse<TKeyComparator>(file::read(path)), overrideStyle);
+			this->deep_merge(parse_file<TKeyComparator>(path), overrideStyle);
+		}
+		/**
+		 * @brief					Reads multiple INI config files concurrently, then merges their contents into this instance in the order they were specified.
+		 *\n						The result is the same as calling read() for each path in order; later files take priority when overrideStyle is OverrideStyle::Override.
+		 * @param paths				The locations of the config files, from lowest to highest priority.
+		 * @param config			An ini_parser_config instance to use when parsing the files.
+		 * @param overrideStyle		The OverrideStyle to use when deep merging the parsed data into this instance.
+		 */
+		void read_files(std::vector<std::filesystem::path> const& paths, ParserConfig const& config, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
+		{
+			for (auto& container : parse_files<TKeyComparator>(paths, config))
+				this->deep_merge(std::move(container), overrideStyle);
+		}
+		/**
+		 * @brief					Reads multiple INI config files concurrently, then merges their contents into this instance in the order they were specified.
+		 *\n						The result is the same as calling read() for each path in order; later files take priority when overrideStyle is OverrideStyle::Override.
+		 * @param paths				The locations of the config files, from lowest to highest priority.
+		 * @param overrideStyle		The OverrideStyle to use when deep merging the parsed data into this instance.
+		 */
+		void read_files(std::vector<std::filesystem::path> const& paths, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
+		{
+			this->read_files(paths, ParserConfig{}, overrideStyle);
+		}
+		/**
+		 * @brief					Reads multiple INI config files concurrently on the given thread pool, then merges their contents into this instance in the order they were specified.
+		 *\n						The result is the same as calling read() for each path in order; later files take priority when overrideStyle is OverrideStyle::Override.
+		 * @param paths				The locations of the config files, from lowest to highest priority.
+		 * @param config			An ini_parser_config instance to use when parsing the files.
+		 * @param pool				The thread pool to parse the files on.
+		 * @param overrideStyle		The OverrideStyle to use when deep merging the parsed data into this instance.
+		 */
+		void read_files(std::vector<std::filesystem::path> const& paths, ParserConfig const& config, shared::thread_pool& pool, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
+		{
+			for (auto& container : parse_files<TKeyComparator>(paths, config, pool))
+				this->deep_merge(std::move(container), overrideStyle);
 		}
 	#pragma endregion read
 
 	#pragma region write
 		/**
-		 * @brief		Reads the specified INI config file and merges its contents into this instance according to the given OverrideStyle.
-		 * @param path	The location of the config file.
-		 * @returns		true when the file was successfully written to; otherwise false.
+		 * @brief				Writes this instance to the specified file, replacing its previous contents.
+		 *\n					The output is serialized into a single pre-sized buffer, which is written to a temporary file & renamed over the target.
+		 *\n					The file is never left partially written; if writing fails, the previous contents are unchanged.
+		 * @param path			The location of the config file.
+		 * @param sortOutput	When true, sections & keys are written in lexicographical order so the output is stable & diffable.
+		 * @param durable		When true, the file is flushed to the storage device before returning, so the new contents survive a power loss.
+		 * @returns				true when the file was successfully written to; otherwise false.
 		 */
-		bool write(std::filesystem::path const& path) const noexcept(false)
+		bool write(std::filesystem::path const& path, bool const sortOutput = false, bool const durable = false) const noexcept(false)
 		{
-			const auto& result{ file::write(path, Printer((container_t*)&map)) };
-			return result;
+			ini_printer<TKeyComparator> printer{ &map };
+			printer.sortOutput = sortOutput;
+			const auto& buffer{ printer.str() };
+			return file::write_atomic(path, buffer, durable);
 		}
 	#pragma endregion write
 
+	#pragma region freeze
+		/**
+		 * @brief		Creates an immutable, contiguous copy of this instance that is faster to search & uses less memory.
+		 * @returns		A basic_frozen_ini instance containing all of the headers, keys, and values in this instance.
+		 */
+		basic_frozen_ini<TKeyComparator> freeze() const noexcept(false)
+		{
+			return basic_frozen_ini<TKeyComparator>{ map };
+		}
+	#pragma endregion freeze
+
+	#pragma region diff
+		/**
+		 * @brief			Compares this instance to another container and lists the keys that were added, removed, or changed.
+		 * @param other		The modified container.
+		 * @returns			An ini_diff that transforms this instance into other when passed to apply().
+		 */
+		ini_diff diff(container_t const& other) const
+		{
+			return ::ini::diff<TKeyComparator>(map, other);
+		}
+		/**
+		 * @brief			Compares this instance to another INI and lists the keys that were added, removed, or changed.
+		 * @param other		The modified INI.
+		 * @returns			An ini_diff that transforms this instance into other when passed to apply().
+		 */
+		ini_diff diff(this_t const& other) const
+		{
+			return ::ini::diff<TKeyComparator>(map, other.map);
+		}
+		/**
+		 * @brief			Applies a list of changes to this instance in-place. Sections are removed when their last key is removed.
+		 * @param changes	The changes to apply, usually from diff().
+		 * @returns			The reference of this instance.
+		 */
+		this_t& apply(ini_diff const& changes)
+		{
+			::ini::apply<TKeyComparator>(map, changes);
+			return *this;
+		}
+	#pragma endregion diff
+
 	#pragma region map_methods
 		/// @returns	An iterator to the beginning of the range of headers & sections.
 		auto begin() noexcept { return map.begin(); }
@@ -1055,12 +2531,12 @@ namespace ini {
 		/// @returns	An iterator to the header-section pair with a matching header.
 		auto find_if(auto&& predicate) const { return std::find_if(map.begin(), map.end(), $fwd(predicate)); }
 		/// @returns	true when the map contains the specified header; otherwise false.
-		auto contains(auto&& header) const noexcept { return map.contains($fwd(header)); }
-		/// @returns	true when the map contains the specified header; otherwise false.
-		auto contains(auto&& header, auto&& key) const noexcept
+		bool contains(std::string_view const& header) const noexcept { return map.contains(header); }
+		/// @returns	true when the map contains the specified header & key; otherwise false.
+		bool contains(std::string_view const& header, std::string_view const& key) const noexcept
 		{
-			if (const auto& it{ map.find($fwd(header)) }; it != map.end())
-				return it->contains($fwd(key));
+			if (const auto& it{ map.find(header) }; it != map.end())
+				return it->second.contains(key);
 			return false;
 		}
 		auto insert_or_assign(auto&& header, auto&& key, auto&& value)
@@ -1070,21 +2546,22 @@ namespace ini {
 		/**
 		 * @brief			Removes the specified section from the INI container.
 		 * @param header	The name of the target header. (Leave blank for global)
-		 * @returns			The index of the removed section.
+		 * @returns			The number of sections that were removed.
 		 */
-		auto erase(auto&& header)
+		size_t erase(std::string_view const& header)
 		{
-			return map.erase($fwd(header));
+			return _internal::erase_key(map, header);
 		}
 		/**
 		 * @brief			Removes the specified key from the specified section in the INI container.
 		 * @param header	The name of the target header. (Leave blank for global)
 		 * @param key		The name of the target key.
-		 * @returns			The index of the removed key, relative to the specified section.
+		 * @returns			The number of keys that were removed.
+		 * @throws			An out-of-range exception is thrown when the specified header doesn't exist.
 		 */
-		auto erase(auto&& header, auto&& key)
+		size_t erase(std::string_view const& header, std::string_view const& key)
 		{
-			return map.at($fwd(header)).erase($fwd(key));
+			return _internal::erase_key(this->at(header), key);
 		}
 		auto erase(container_t::iterator pos)
 		{
@@ -1107,9 +2584,9 @@ namespace ini {
 		 * @returns			A reference to the section with the given header.
 		 * @throws			An out-of-range exception is thrown when the specified header doesn't exist.
 		 */
-		section_t& at(std::string const& header) noexcept(false)
+		section_t& at(std::string_view const& header) noexcept(false)
 		{
-			return map.at(header);
+			return _internal::at(map, header);
 		}
 		/**
 		 * @brief			Gets an immutable reference to the section with the given header.
@@ -1117,9 +2594,9 @@ namespace ini {
 		 * @returns			A const reference to the section with the given header.
 		 * @throws			An out-of-range exception is thrown when the specified header doesn't exist.
 		 */
-		const section_t& at(std::string const& header) const noexcept(false)
+		const section_t& at(std::string_view const& header) const noexcept(false)
 		{
-			return map.at(header);
+			return _internal::at(map, header);
 		}
 		/**
 		 * @brief			Gets a mutable reference to the value of a specified key.
@@ -1128,9 +2605,9 @@ namespace ini {
 		 * @returns			A reference to the value of the specified key.
 		 * @throws			An out-of-range exception is thrown when the specified header or key doesn't exist.
 		 */
-		ini_value& at(std::string const& header, std::string const& key) noexcept(false)
+		ini_value& at(std::string_view const& header, std::string_view const& key) noexcept(false)
 		{
-			return map.at(header).at(key);
+			return _internal::at(_internal::at(map, header), key);
 		}
 		/**
 		 * @brief			Gets an immutable reference to the value of a specified key.
@@ -1139,63 +2616,29 @@ namespace ini {
 		 * @returns			A const reference to the value of the specified key.
 		 * @throws			An out-of-range exception is thrown when the specified header or key doesn't exist.
 		 */
-		const ini_value& at(std::string const& header, std::string const& key) const noexcept(false)
+		const ini_value& at(std::string_view const& header, std::string_view const& key) const noexcept(false)
 		{
-			return map.at(header).at(key);
+			return _internal::at(_internal::at(map, header), key);
 		}
 	#pragma endregion at
 
 	#pragma region get
 		/**
-		 * @brief			Gets the value of the specified key.
-		 * @param header	The name of the target header. (Leave blank for global)
-		 * @param key		The name of the target key.
-		 * @returns			The value of the specified key, or std::nullopt if the specified header or key doesn't exist.
-		 */
-		std::optional<ini_value> get(std::string const& header, std::string const& key) const noexcept
-		{
-			// find the target header-section pair:
-			if (const auto& headerSectionPr{ map.find(header) }; headerSectionPr != map.end()) {
-				// find the target key:
-				if (const auto& k{ headerSectionPr->second.find(key) }; k != headerSectionPr->second.end()) {
-					return k->second;
-				}
-			}
-			return std::nullopt;
-		}
-		/**
-		 * @brief			Gets the value of the specified key.
+		 * @brief			Gets a pointer to the value of the specified key, without copying it.
 		 * @param header	The name of the target header. (Leave blank for global)
 		 * @param key		The name of the target key.
-		 * @returns			The value of the specified key, or std::nullopt if the specified header or key doesn't exist.
+		 * @returns			A pointer to the value of the specified key, or nullptr if the specified header or key doesn't exist.
 		 */
-		std::optional<ini_value> get(std::string const& header, std::string&& key) const noexcept
+		const ini_value* get_if(std::string_view const& header, std::string_view const& key) const noexcept
 		{
 			// find the target header-section pair:
 			if (const auto& headerSectionPr{ map.find(header) }; headerSectionPr != map.end()) {
-				// find the target key:
-				if (const auto& k{ headerSectionPr->second.find($fwd(key)) }; k != headerSectionPr->second.end()) {
-					return k->second;
-				}
-			}
-			return std::nullopt;
-		}
-		/**
-		 * @brief			Gets the value of the specified key.
-		 * @param header	The name of the target header. (Leave blank for global)
-		 * @param key		The name of the target key.
-		 * @returns			The value of the specified key, or std::nullopt if the specified header or key doesn't exist.
-		 */
-		std::optional<ini_value> get(std::string&& header, std::string const& key) const noexcept
-		{
-			// find the target header-section pair:
-			if (const auto& headerSectionPr{ map.find($fwd(header)) }; headerSectionPr != map.end()) {
 				// find the target key:
 				if (const auto& k{ headerSectionPr->second.find(key) }; k != headerSectionPr->second.end()) {
-					return k->second;
+					return &k->second;
 				}
 			}
-			return std::nullopt;
+			return nullptr;
 		}
 		/**
 		 * @brief			Gets the value of the specified key.
@@ -1203,15 +2646,10 @@ namespace ini {
 		 * @param key		The name of the target key.
 		 * @returns			The value of the specified key, or std::nullopt if the specified header or key doesn't exist.
 		 */
-		std::optional<ini_value> get(std::string&& header, std::string&& key) const noexcept
+		std::optional<ini_value> get(std::string_view const& header, std::string_view const& key) const noexcept
 		{
-			// find the target header-section pair:
-			if (const auto& headerSectionPr{ map.find($fwd(header)) }; headerSectionPr != map.end()) {
-				// find the target key:
-				if (const auto& k{ headerSectionPr->second.find($fwd(key)) }; k != headerSectionPr->second.end()) {
-					return k->second;
-				}
-			}
+			if (const auto* value{ get_if(header, key) })
+				return *value;
 			return std::nullopt;
 		}
 	#pragma endregion get
@@ -1224,42 +2662,11 @@ namespace ini {
 		 * @param defaultValue		A default value or string that will be returned if the specified key doesn't exist.
 		 * @returns					The value of the specified key, or defaultValue if the specified header or key doesn't exist.
 		*/
-		ini_value get_or(std::string const& header, std::string const& key, ini_value const& defaultValue) const noexcept
-		{
-			return get(header, key).value_or(defaultValue);
-		}
-		/**
-		 * @brief					Gets the value of the specified key, or a default value if it doesn't exist.
-		 * @param header			The name of the target header. (Leave blank for global)
-		 * @param key				The name of the target key.
-		 * @param defaultValue		A default value or string that will be returned if the specified key doesn't exist.
-		 * @returns					The value of the specified key, or defaultValue if the specified header or key doesn't exist.
-		*/
-		ini_value get_or(std::string const& header, std::string&& key, ini_value const& defaultValue) const noexcept
+		ini_value get_or(std::string_view const& header, std::string_view const& key, ini_value const& defaultValue) const noexcept
 		{
-			return get(header, $fwd(key)).value_or(defaultValue);
-		}
-		/**
-		 * @brief					Gets the value of the specified key, or a default value if it doesn't exist.
-		 * @param header			The name of the target header. (Leave blank for global)
-		 * @param key				The name of the target key.
-		 * @param defaultValue		A default value or string that will be returned if the specified key doesn't exist.
-		 * @returns					The value of the specified key, or defaultValue if the specified header or key doesn't exist.
-		*/
-		ini_value get_or(std::string&& header, std::string const& key, ini_value const& defaultValue) const noexcept
-		{
-			return get($fwd(header), key).value_or(defaultValue);
-		}
-		/**
-		 * @brief					Gets the value of the specified key, or a default value if it doesn't exist.
-		 * @param header			The name of the target header. (Leave blank for global)
-		 * @param key				The name of the target key.
-		 * @param defaultValue		A default value or string that will be returned if the specified key doesn't exist.
-		 * @returns					The value of the specified key, or defaultValue if the specified header or key doesn't exist.
-		*/
-		ini_value get_or(std::string&& header, std::string&& key, ini_value const& defaultValue) const noexcept
-		{
-			return get($fwd(header), $fwd(key)).value_or(defaultValue);
+			if (const auto* value{ get_if(header, key) })
+				return *value;
+			return defaultValue;
 		}
 	#pragma endregion get_or
 
@@ -1271,9 +2678,9 @@ namespace ini {
 		 * @param value		The value to set the specified key to. **Must be implicitly convertible to std::string.**
 		 */
 		template<std::convertible_to<std::string> TValue> requires (!std::same_as<std::decay_t<TValue>, std::string>)
-			void set(std::string const& header, std::string const& key, TValue&& value) noexcept
+			void set(std::string_view const& header, std::string_view const& key, TValue&& value) noexcept
 		{
-			map[header][key] = std::string{ std::forward<TValue>(value) };
+			this->operator()(header, key) = std::string{ std::forward<TValue>(value) };
 		}
 		/**
 		 * @brief			Sets the value of the specified key.
@@ -1281,9 +2688,9 @@ namespace ini {
 		 * @param key		The name of the target key.
 		 * @param value		The value to set the specified key to.
 		 */
-		void set(std::string const& header, std::string const& key, std::string&& value) noexcept
+		void set(std::string_view const& header, std::string_view const& key, std::string&& value) noexcept
 		{
-			map[header][key] = std::forward<std::string>(value);
+			this->operator()(header, key) = std::forward<std::string>(value);
 		}
 		/**
 		 * @brief			Sets the value of the specified key.
@@ -1291,9 +2698,9 @@ namespace ini {
 		 * @param key		The name of the target key.
 		 * @param value		The value to set the specified key to.
 		 */
-		void set(std::string const& header, std::string const& key, std::string const& value) noexcept
+		void set(std::string_view const& header, std::string_view const& key, std::string const& value) noexcept
 		{
-			map[header][key] = value;
+			this->operator()(header, key) = value;
 		}
 	#pragma endregion set
 
@@ -1304,14 +2711,7 @@ namespace ini {
 		 * @param key		The name of the target key.
 		 * @returns			true when the specified key exists; otherwise false.
 		 */
-		CONSTEXPR bool check(std::string const& header, std::string const& key) const noexcept { return this->get(header, key).has_value(); }
-		/**
-		 * @brief			Checks if the specified key exists.
-		 * @param header	The name of the target header. (Leave blank for global)
-		 * @param key		The name of the target key.
-		 * @returns			true when the specified key exists; otherwise false.
-		 */
-		CONSTEXPR bool check(std::string&& header, std::string&& key) const noexcept { return this->get($fwd(header), $fwd(key)).has_value(); }
+		CONSTEXPR bool check(std::string_view const& header, std::string_view const& key) const noexcept { return this->contains(header, key); }
 		/**
 		 * @brief					Compares the current value of the specified key to the given expected_value.
 		 * @param header			The name of the target header. (Leave blank for global)
@@ -1319,28 +2719,23 @@ namespace ini {
 		 * @param expected_value	An ini_value to compare to the current value of the specified key.
 		 * @returns					true when the value of the specified key matches the expected_value; otherwise false. If the specified key doesn't exist, returns false.
 		 */
-		CONSTEXPR bool checkv(std::string const& header, std::string const& key, ini_value const& expected_value) const noexcept
+		CONSTEXPR bool checkv(std::string_view const& header, std::string_view const& key, ini_value const& expected_value) const noexcept
 		{
-			const auto& v{ this->get(header, key) };
-			return (v.has_value() ? (v.value() == expected_value) : false);
+			const auto* v{ this->get_if(header, key) };
+			return (v != nullptr ? (*v == expected_value) : false);
 		}
 		/**
 		 * @brief					Compares the current value of the specified key to the given expected_value.
 		 * @param header			The name of the target header. (Leave blank for global)
 		 * @param key				The name of the target key.
-		 * @param expected_value	An ini_value to compare to the current value of the specified key.
+		 * @param expected_value	A value to compare to the current value of the specified key.
 		 * @returns					true when the value of the specified key matches the expected_value; otherwise false. If the specified key doesn't exist, returns false.
 		 */
-		CONSTEXPR bool checkv(std::string&& header, std::string&& key, ini_value&& expected_value) const noexcept
-		{
-			const auto& v{ this->get($fwd(header), $fwd(key)) };
-			return (v.has_value() ? (v.value() == $fwd(expected_value)) : false);
-		}
 		template<typename T>
-		CONSTEXPR bool checkv(std::string&& header, std::string&& key, const T& expected_value) const
+		CONSTEXPR bool checkv(std::string_view const& header, std::string_view const& key, const T& expected_value) const
 		{
-			const auto& v{ this->get($fwd(header), $fwd(key)) };
-			return (v.has_value() ? (v.value() == expected_value) : false);
+			const auto* v{ this->get_if(header, key) };
+			return (v != nullptr ? (*v == expected_value) : false);
 		}
 	#pragma endregion check
 
@@ -1355,9 +2750,9 @@ namespace ini {
 		 * @param header	The name of the target header. (Leave blank for global)
 		 * @returns			The reference of the specified header.
 		 */
-		section_t& operator[](const std::string& header) noexcept
+		section_t& operator[](std::string_view const& header) noexcept
 		{
-			return map[header];
+			return _internal::find_or_insert(map, header);
 		}
 	#pragma endregion operator[]
 
@@ -1368,36 +2763,14 @@ namespace ini {
 		 * @param key		The name of the target key.
 		 * @returns			A reference to the value of the target key.
 		 */
-		WINCONSTEXPR ini_value& operator()(const std::string& header, const std::string& key) noexcept { return map.operator[](header)[key]; }
-		/**
-		 * @brief			Gets the value of the specified key, or creates it if it doesn't exist.
-		 * @param header	The name of the target header. (Leave blank for global)
-		 * @param key		The name of the target key.
-		 * @returns			A reference to the value of the target key.
-		 */
-		WINCONSTEXPR ini_value& operator()(std::string&& header, std::string&& key) noexcept { return map.operator[]($fwd(header))[$fwd(key)]; }
-		/**
-		 * @brief			Gets the value of the specified key, or throws an exception if it doesn't exist.
-		 * @param header	The name of the target header. (Leave blank for global)
-		 * @param key		The name of the target key.
-		 * @returns			A reference to the value of the target key.
-		 */
-		WINCONSTEXPR ini_value operator()(const std::string& header, const std::string& key) const noexcept(false) { return map.at(header).at(key); }
+		WINCONSTEXPR ini_value& operator()(std::string_view const& header, std::string_view const& key) noexcept { return _internal::find_or_insert(_internal::find_or_insert(map, header), key); }
 		/**
 		 * @brief			Gets the value of the specified key, or throws an exception if it doesn't exist.
 		 * @param header	The name of the target header. (Leave blank for global)
 		 * @param key		The name of the target key.
 		 * @returns			A reference to the value of the target key.
 		 */
-		WINCONSTEXPR ini_value operator()(std::string&& header, std::string&& key) const noexcept(false) { return map.at($fwd(header)).at($fwd(key)); }
-		/**
-		 * @brief					Compares the current value of the specified key to the given expected_value.
-		 * @param header			The name of the target header. (Leave blank for global)
-		 * @param key				The name of the target key.
-		 * @param expected_value	An ini_value to compare to the current value of the specified key.
-		 * @returns					true when the value of the specified key matches the expected_value; otherwise false. If the specified key doesn't exist, returns false.
-		 */
-		WINCONSTEXPR bool operator()(std::string const& header, std::string const& key, ini_value const& expected_value) const noexcept { return checkv(header, key, expected_value); }
+		WINCONSTEXPR ini_value operator()(std::string_view const& header, std::string_view const& key) const noexcept(false) { return this->at(header, key); }
 		/**
 		 * @brief					Compares the current value of the specified key to the given expected_value.
 		 * @param header			The name of the target header. (Leave blank for global)
@@ -1405,7 +2778,7 @@ namespace ini {
 		 * @param expected_value	An ini_value to compare to the current value of the specified key.
 		 * @returns					true when the value of the specified key matches the expected_value; otherwise false. If the specified key doesn't exist, returns false.
 		 */
-		WINCONSTEXPR bool operator()(std::string&& header, std::string&& key, ini_value&& expected_value) const noexcept { return checkv($fwd(header), $fwd(key), $fwd(expected_value)); }
+		WINCONSTEXPR bool operator()(std::string_view const& header, std::string_view const& key, ini_value const& expected_value) const noexcept { return checkv(header, key, expected_value); }
 
 	#pragma endregion operator()
 
@@ -1413,7 +2786,7 @@ namespace ini {
 		/// @brief	Inserts the plaintext data contained by ini into the output stream in the correct format using ini_printer.
 		friend std::ostream& operator<<(std::ostream& os, const this_t& ini)
 		{
-			return os << ini_printer<TKeyComparator>{ &ini };
+			return os << ini_printer<TKeyComparator>{ &ini.map };
 		}
 		/// @brief	Extracts the data contained by the std::istream and parses it, storing the result in the given ini instance. **Note that using this means you can't use a parser config!**
 		friend std::istream& operator>>(std::istream& is, this_t& ini)
@@ -1425,6 +2798,235 @@ namespace ini {
 	};
 #pragma endregion basic_ini
 
+#pragma region basic_ini_reloader
+	/**
+	 * @class	basic_ini_reloader
+	 * @brief	Loads a layered set of INI files into a basic_ini, and incrementally reloads it when the files change.
+	 *\n		Each file is parsed separately & kept in memory, so a reload only re-parses the files that were modified,
+	 *\n		 and only the keys that changed in those files are re-merged & updated in the INI.
+	 */
+	template<class TKeyComparator = CaseInsensitiveCompare>
+	class basic_ini_reloader {
+		using this_t = basic_ini_reloader<TKeyComparator>;
+		using ini_t = basic_ini<TKeyComparator>;
+		using container_t = ini_container<TKeyComparator>;
+		using config_t = ini_parser_config<TKeyComparator>;
+
+		/// @brief	The properties of a file that are used to detect modifications.
+		struct file_stamp {
+			bool exists{ false };
+			std::filesystem::file_time_type mtime{};
+			uintmax_t size{ 0 };
+			size_t hash{ 0 };
+
+			/// @returns	true when the metadata of both stamps are the same; the content hashes aren't compared.
+			bool same_metadata(file_stamp const& o) const noexcept { return exists == o.exists && mtime == o.mtime && size == o.size; }
+		};
+		/// @brief	A single INI file & its most recently parsed contents.
+		struct layer {
+			std::filesystem::path path;
+			file_stamp stamp;
+			container_t data;
+		};
+		/// @brief	A callback that is notified of changes to a header, or to a specific key.
+		struct subscription {
+			std::string header;
+			std::optional<std::string> key;
+			std::function<void(ini_change const&)> callback;
+		};
+
+		std::vector<layer> layers;
+		config_t config;
+		OverrideStyle overrideStyle;
+		ini_t ini;
+		std::vector<subscription> subscriptions;
+
+		/// @returns	The metadata of the file at the given path, without its content hash.
+		static file_stamp stat(std::filesystem::path const& path) noexcept
+		{
+			file_stamp stamp;
+			std::error_code ec;
+			if (stamp.mtime = std::filesystem::last_write_time(path, ec); ec)
+				return{};
+			if (stamp.size = std::filesystem::file_size(path, ec); ec)
+				return{};
+			stamp.exists = true;
+			return stamp;
+		}
+		/// @returns	The contents of the file at the given path, or an empty string if it doesn't exist.
+		/// @note		Files that are being watched for changes may be truncated by other processes at any time, so they're copied instead of mapped.
+		static std::string read_contents(std::filesystem::path const& path, file_stamp const& stamp)
+		{
+			if (!stamp.exists)
+				return{};
+			return file::read_all(path);
+		}
+
+		/**
+		 * @brief			Finds the value that the given key should have in the merged INI, by merging it from each layer in order.
+		 * @param sources	The contents of each layer, in the same order as layers.
+		 * @param header	The name of the target header.
+		 * @param key		The name of the target key.
+		 * @returns			A pointer to the merged value, or nullptr if none of the layers contain the key.
+		 */
+		const ini_value* merged_value(std::vector<const container_t*> const& sources, std::string_view const& header, std::string_view const& key) const noexcept(false)
+		{
+			const ini_value* result{ nullptr };
+			for (const auto* data : sources) {
+				const auto& section{ data->find(header) };
+				if (section == data->end())
+					continue;
+				const auto& it{ section->second.find(key) };
+				if (it == section->second.end())
+					continue;
+				if (result == nullptr) {
+					result = &it->second;
+					continue;
+				}
+				switch (overrideStyle) {
+				case OverrideStyle::OnlyBlank:
+					if (!result->empty())
+						break; //< break if current value is NOT empty
+					else [[fallthrough]];
+				case OverrideStyle::Override:
+					result = &it->second;
+					break;
+				case OverrideStyle::Throw:
+					throw ex::make_custom_exception<ini_key_exception>("Duplicate keys aren't allowed; '", header, (header.empty() ? "" : "::"), key, "' already has value '", *result, "'! (Incoming value: '", it->second, "')");
+				case OverrideStyle::Skip: [[fallthrough]];
+				default:break;
+				}
+			}
+			return result;
+		}
+
+	public:
+		/**
+		 * @brief					Loads the given files.
+		 * @param paths				The locations of the INI files, from lowest to highest priority. Files that don't exist are treated as empty, and are loaded if they're created later.
+		 * @param config			Parser configuration instance.
+		 * @param overrideStyle		Determines how keys that appear in more than one file are merged.
+		 */
+		basic_ini_reloader(std::vector<std::filesystem::path> const& paths, config_t const& config = {}, OverrideStyle const& overrideStyle = OverrideStyle::Override) noexcept(false)
+			: config{ config }, overrideStyle{ overrideStyle }
+		{
+			layers.reserve(paths.size());
+			for (const auto& path : paths) {
+				auto stamp{ stat(path) };
+				const auto& content{ read_contents(path, stamp) };
+				stamp.hash = std::hash<std::string_view>{}(content);
+				layers.push_back({ path, stamp, parse<TKeyComparator>(std::string_view{ content }, config) });
+				ini.deep_merge(layers.back().data, overrideStyle);
+			}
+		}
+
+		/// @returns	The merged INI.
+		ini_t const& get() const noexcept { return ini; }
+		/// @returns	The merged INI.
+		ini_t const& operator*() const noexcept { return ini; }
+		/// @returns	The merged INI.
+		ini_t const* operator->() const noexcept { return &ini; }
+
+		/**
+		 * @brief		Checks if any of the files were modified since they were last loaded, based on their size & last write time.
+		 * @returns		true when at least one of the files' metadata changed; otherwise false.
+		 */
+		bool is_modified() const noexcept
+		{
+			return std::any_of(layers.begin(), layers.end(), [](auto&& layer) { return !stat(layer.path).same_metadata(layer.stamp); });
+		}
+
+		/**
+		 * @brief			Registers a callback that is called by reload() for each change to any key in the given section.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param callback	A function that accepts the ini_change that occurred.
+		 */
+		void subscribe(std::string_view const& header, std::function<void(ini_change const&)> callback)
+		{
+			subscriptions.push_back({ std::string{ header }, std::nullopt, std::move(callback) });
+		}
+		/**
+		 * @brief			Registers a callback that is called by reload() when the given key changes.
+		 * @param header	The name of the target header. (Leave blank for global)
+		 * @param key		The name of the target key.
+		 * @param callback	A function that accepts the ini_change that occurred.
+		 */
+		void subscribe(std::string_view const& header, std::string_view const& key, std::function<void(ini_change const&)> callback)
+		{
+			subscriptions.push_back({ std::string{ header }, std::string{ key }, std::move(callback) });
+		}
+
+		/**
+		 * @brief		Re-parses the files that were modified since they were last loaded, and updates the merged INI in-place.
+		 *\n			Files whose size & last write time are unchanged aren't read, and files whose contents hash is unchanged aren't parsed.
+		 *\n			Subscribers are notified of each change that affects them after the INI has been updated.
+		 * @returns		The changes that were made to the merged INI.
+		 * @throws		Any exceptions thrown while reading, parsing, or merging the files.
+		 *\n			Nothing is changed when an exception is thrown; every modified file is read again by the next call.
+		 */
+		ini_diff reload() noexcept(false)
+		{
+			// read & parse every modified layer into temporaries first, so that a failure can't leave some of them updated
+			std::vector<file_stamp> stamps;
+			std::vector<std::optional<container_t>> parsed(layers.size());
+			std::vector<const container_t*> sources;
+			stamps.reserve(layers.size());
+			sources.reserve(layers.size());
+			for (size_t i{ 0 }; i < layers.size(); ++i) {
+				const auto& layer{ layers[i] };
+				auto& stamp{ stamps.emplace_back(stat(layer.path)) };
+				if (stamp.same_metadata(layer.stamp))
+					stamp = layer.stamp;
+				else {
+					const auto& content{ read_contents(layer.path, stamp) };
+					stamp.hash = std::hash<std::string_view>{}(content);
+					if (stamp.exists != layer.stamp.exists || stamp.hash != layer.stamp.hash)
+						parsed[i] = parse<TKeyComparator>(std::string_view{ content }, config);
+				}
+				sources.push_back(parsed[i].has_value() ? &parsed[i].value() : &layer.data);
+			}
+
+			container_t touched;
+			for (size_t i{ 0 }; i < layers.size(); ++i) {
+				if (parsed[i].has_value()) {
+					for (const auto& change : ::ini::diff<TKeyComparator>(layers[i].data, parsed[i].value()))
+						_internal::find_or_insert(_internal::find_or_insert(touched, change.header), change.key);
+				}
+			}
+
+			// merging can throw when overrideStyle is OverrideStyle::Throw, so all of the changes are found before any are committed
+			ini_diff changes;
+			for (const auto& [header, section] : touched) {
+				for (const auto& [key, _] : section) {
+					const auto* current{ ini.get_if(header, key) };
+					const auto* merged{ merged_value(sources, header, key) };
+					if (current == nullptr && merged != nullptr)
+						changes.push_back({ ChangeType::Added, header, key, {}, *merged });
+					else if (current != nullptr && merged == nullptr)
+						changes.push_back({ ChangeType::Removed, header, key, *current, {} });
+					else if (current != nullptr && merged != nullptr && *current != *merged)
+						changes.push_back({ ChangeType::Changed, header, key, *current, *merged });
+				}
+			}
+
+			ini.apply(changes);
+			for (size_t i{ 0 }; i < layers.size(); ++i) {
+				if (parsed[i].has_value())
+					layers[i].data = std::move(parsed[i].value());
+				layers[i].stamp = stamps[i];
+			}
+
+			for (const auto& change : changes) {
+				for (const auto& sub : subscriptions) {
+					if (TKeyComparator{}(sub.header, change.header) && (!sub.key.has_value() || TKeyComparator{}(sub.key.value(), change.key)))
+						sub.callback(change);
+				}
+			}
+			return changes;
+		}
+	};
+#pragma endregion basic_ini_reloader
+
 #pragma region usings
 	/// @brief	INI class that uses *case-insensitive* key comparisons, and narrow-width chars.
 	using INI = basic_ini<CaseInsensitiveCompare>;
@@ -1440,5 +3042,13 @@ namespace ini {
 	using cParserConfig = ini_parser_config<CaseSensitiveCompare>;
 	using Printer = ini_printer<CaseInsensitiveCompare>;
 	using cPrinter = ini_printer<CaseSensitiveCompare>;
+	/// @brief	Frozen INI class that uses *case-insensitive* key comparisons.
+	using FrozenINI = basic_frozen_ini<CaseInsensitiveCompare>;
+	/// @brief	Frozen INI class that uses *case-sensitive* key comparisons.
+	using cFrozenINI = basic_frozen_ini<CaseSensitiveCompare>;
+	/// @brief	INI reloader class that uses *case-insensitive* key comparisons.
+	using INIReloader = basic_ini_reloader<CaseInsensitiveCompare>;
+	/// @brief	INI reloader class that uses *case-sensitive* key comparisons.
+	using cINIReloader = basic_ini_reloader<CaseSensitiveCompare>;
 #pragma endregion usings
 }
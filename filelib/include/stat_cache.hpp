@@ -0,0 +1,262 @@
+/**
+ * @file	stat_cache.hpp
+ * @author	radj307
+ * @brief	Contains the file_stat structure & stat() function, which retrieve a file's metadata with a single system call,
+ *\n		 and the stat_cache object, which serves repeated metadata queries from memory.
+ */
+#pragma once
+#include <sysarch.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#ifdef OS_WIN
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else // POSIX
+#include <cerrno>
+#include <sys/stat.h>
+#endif
+
+namespace file {
+	/**
+	 * @struct	file_stat
+	 * @brief	The metadata of a file, as returned by file::stat().
+	 */
+	struct file_stat {
+		/// @brief	The type of the file; this is file_type::not_found when it doesn't exist.
+		std::filesystem::file_type type{ std::filesystem::file_type::none };
+		/// @brief	The size of the file, in bytes. This is 0 for anything other than regular files.
+		std::uintmax_t size{ 0 };
+		/// @brief	The time that the file was last modified.
+		std::filesystem::file_time_type mtime{};
+		/// @brief	The error that occurred when the metadata couldn't be retrieved. Files that don't exist aren't considered an error.
+		std::error_code error;
+
+		/// @returns	true when the file exists.
+		bool exists() const noexcept { return type != std::filesystem::file_type::none && type != std::filesystem::file_type::not_found; }
+		/// @returns	true when the file is a regular file.
+		bool is_regular_file() const noexcept { return type == std::filesystem::file_type::regular; }
+		/// @returns	true when the file is a directory.
+		bool is_directory() const noexcept { return type == std::filesystem::file_type::directory; }
+	};
+
+	/**
+	 * @brief		Retrieves the type, size & modification time of a file with a single system call.
+	 *\n			This is equivalent to calling std::filesystem::status, file_size, and last_write_time, which each query the file separately.
+	 * @param path	The location of the target file.
+	 * @returns		The metadata of the file. When it doesn't exist, type is file_type::not_found.
+	 */
+	inline file_stat stat(std::filesystem::path const& path) noexcept
+	{
+		file_stat result;
+	#ifdef OS_WIN
+		// unlike stat(), this doesn't follow symbolic links; it reports the attributes of the link itself
+		WIN32_FILE_ATTRIBUTE_DATA data{};
+		if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data)) {
+			const auto& error{ GetLastError() };
+			if (error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND || error == ERROR_INVALID_NAME)
+				result.type = std::filesystem::file_type::not_found;
+			else result.error.assign(static_cast<int>(error), std::system_category());
+			return result;
+		}
+		if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			result.type = std::filesystem::file_type::directory;
+		else {
+			result.type = std::filesystem::file_type::regular;
+			result.size = (static_cast<std::uintmax_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+		}
+		// file_time_type counts 100ns intervals since 1601, the same as FILETIME
+		const auto& ticks{ (static_cast<std::int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime };
+		result.mtime = std::filesystem::file_time_type{ std::filesystem::file_time_type::duration{ ticks } };
+	#else
+		struct stat st {};
+		if (::stat(path.c_str(), &st) == -1) {
+			if (errno == ENOENT || errno == ENOTDIR)
+				result.type = std::filesystem::file_type::not_found;
+			else result.error.assign(errno, std::generic_category());
+			return result;
+		}
+		if (S_ISREG(st.st_mode)) {
+			result.type = std::filesystem::file_type::regular;
+			result.size = static_cast<std::uintmax_t>(st.st_size);
+		}
+		else if (S_ISDIR(st.st_mode))
+			result.type = std::filesystem::file_type::directory;
+		else if (S_ISCHR(st.st_mode))
+			result.type = std::filesystem::file_type::character;
+		else if (S_ISBLK(st.st_mode))
+			result.type = std::filesystem::file_type::block;
+		else if (S_ISFIFO(st.st_mode))
+			result.type = std::filesystem::file_type::fifo;
+		else if (S_ISSOCK(st.st_mode))
+			result.type = std::filesystem::file_type::socket;
+		else result.type = std::filesystem::file_type::unknown;
+
+	#ifdef OS_MAC
+		const auto& ts{ st.st_mtimespec };
+	#else
+		const auto& ts{ st.st_mtim };
+	#endif
+		const std::chrono::sys_time<std::chrono::nanoseconds> time{ std::chrono::seconds{ ts.tv_sec } + std::chrono::nanoseconds{ ts.tv_nsec } };
+		result.mtime = std::chrono::time_point_cast<std::filesystem::file_time_type::duration>(std::chrono::file_clock::from_sys(time));
+	#endif
+		return result;
+	}
+	/**
+	 * @brief		Retrieves the metadata of multiple files.
+	 * @param paths	The locations of the target files.
+	 * @returns		The metadata of each file, in the same order as paths.
+	 */
+	inline std::vector<file_stat> stat_many(std::span<const std::filesystem::path> const& paths)
+	{
+		std::vector<file_stat> results;
+		results.reserve(paths.size());
+		for (const auto& path : paths)
+			results.emplace_back(stat(path));
+		return results;
+	}
+
+	/**
+	 * @class	stat_cache
+	 * @brief	A thread-safe cache of file metadata, which serves repeated queries for the same files from memory.
+	 *\n		Each entry is kept for a fixed amount of time (the TTL), after which the file is queried again the next time it's requested.
+	 *\n		Changes made to a file within the TTL aren't seen unless the file is invalidated, so the TTL should be as long as the caller can tolerate stale results.
+	 */
+	class stat_cache {
+		using clock = std::chrono::steady_clock;
+
+		struct entry {
+			file_stat stat;
+			clock::time_point expires;
+		};
+
+		mutable std::shared_mutex mutex;
+		std::unordered_map<std::filesystem::path::string_type, entry> entries;
+		clock::duration ttl;
+		size_t maxEntries;
+
+		/// @brief	Removes expired entries; the mutex must be locked exclusively.
+		void prune(clock::time_point const& now)
+		{
+			std::erase_if(entries, [&now](auto const& it) { return it.second.expires <= now; });
+			// when everything is still fresh, start over rather than letting the cache grow without bound
+			if (entries.size() >= maxEntries)
+				entries.clear();
+		}
+
+		/// @brief	Stores a result in the cache; the mutex must be locked exclusively.
+		void store(std::filesystem::path const& path, file_stat const& result, clock::time_point const& now)
+		{
+			if (result.error)
+				return; //< errors may be transient, so they're never cached
+			if (entries.size() >= maxEntries)
+				prune(now);
+			entries.insert_or_assign(path.native(), entry{ result, now + ttl });
+		}
+
+	public:
+		/// @brief	The default amount of time that entries are kept for.
+		static constexpr std::chrono::milliseconds DEFAULT_TTL{ 1000 };
+		/// @brief	The default maximum number of entries.
+		static constexpr size_t DEFAULT_MAX_ENTRIES{ 65536 };
+
+		/**
+		 * @brief				Creates a new, empty cache.
+		 * @param ttl			The amount of time that each entry is kept for.
+		 * @param maxEntries	The maximum number of entries. When the cache is full, expired entries are removed; if none have expired, the cache is cleared.
+		 */
+		template<class Rep = std::chrono::milliseconds::rep, class Period = std::chrono::milliseconds::period>
+		explicit stat_cache(std::chrono::duration<Rep, Period> const& ttl = DEFAULT_TTL, size_t const maxEntries = DEFAULT_MAX_ENTRIES) :
+			ttl{ std::chrono::duration_cast<clock::duration>(ttl) },
+			maxEntries{ maxEntries == 0 ? DEFAULT_MAX_ENTRIES : maxEntries }
+		{}
+
+		/**
+		 * @brief		Retrieves the metadata of a file, from the cache when it has an entry that hasn't expired.
+		 * @param path	The location of the target file. Paths are cached exactly as they're given, so different spellings of the same path have separate entries.
+		 * @returns		The metadata of the file.
+		 */
+		file_stat get(std::filesystem::path const& path)
+		{
+			const auto& now{ clock::now() };
+			{
+				std::shared_lock<std::shared_mutex> lock(mutex);
+				if (const auto& it{ entries.find(path.native()) }; it != entries.end() && it->second.expires > now)
+					return it->second.stat;
+			}
+			const auto& result{ file::stat(path) };
+			std::unique_lock<std::shared_mutex> lock(mutex);
+			store(path, result, now);
+			return result;
+		}
+		/**
+		 * @brief		Retrieves the metadata of multiple files, querying only the ones that don't have an unexpired entry.
+		 *\n			The cache is locked once for all of the lookups, and once for all of the updates.
+		 * @param paths	The locations of the target files.
+		 * @returns		The metadata of each file, in the same order as paths.
+		 */
+		std::vector<file_stat> stat_many(std::span<const std::filesystem::path> const& paths)
+		{
+			const auto& now{ clock::now() };
+			std::vector<file_stat> results(paths.size());
+			std::vector<size_t> misses;
+			{
+				std::shared_lock<std::shared_mutex> lock(mutex);
+				for (size_t i{ 0 }; i < paths.size(); ++i) {
+					if (const auto& it{ entries.find(paths[i].native()) }; it != entries.end() && it->second.expires > now)
+						results[i] = it->second.stat;
+					else misses.emplace_back(i);
+				}
+			}
+			if (misses.empty())
+				return results;
+
+			for (const auto& i : misses)
+				results[i] = file::stat(paths[i]);
+
+			std::unique_lock<std::shared_mutex> lock(mutex);
+			for (const auto& i : misses)
+				store(paths[i], results[i], now);
+			return results;
+		}
+
+		/// @returns	true when the specified file exists.
+		bool exists(std::filesystem::path const& path) { return get(path).exists(); }
+		/// @returns	The size of the specified file, or 0 if it doesn't exist or isn't a regular file.
+		std::uintmax_t file_size(std::filesystem::path const& path) { return get(path).size; }
+		/// @returns	The time that the specified file was last modified.
+		std::filesystem::file_time_type last_write_time(std::filesystem::path const& path) { return get(path).mtime; }
+
+		/// @brief	Removes the entry for the specified file, so that it's queried again the next time it's requested. Call this after modifying a file.
+		void invalidate(std::filesystem::path const& path)
+		{
+			std::unique_lock<std::shared_mutex> lock(mutex);
+			entries.erase(path.native());
+		}
+		/// @brief	Removes all entries.
+		void clear()
+		{
+			std::unique_lock<std::shared_mutex> lock(mutex);
+			entries.clear();
+		}
+		/// @returns	The number of entries in the cache, including expired entries that haven't been removed yet.
+		size_t size() const
+		{
+			std::shared_lock<std::shared_mutex> lock(mutex);
+			return entries.size();
+		}
+	};
+}
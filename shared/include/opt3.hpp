@@ -11,14 +11,23 @@
 #include <predicate.hpp>
 #include <strcore.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <concepts>
+#include <cstdint>
 #include <compare>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <variant>
 #include <optional>
+#include <ranges>
 #include <set>
+#include <span>
 #include <map>
 #include <execution>
+#include <vector>
 
  /**
   * @namespace	opt3
@@ -88,6 +97,93 @@ namespace opt3 {
 		using flag_t = std::pair<char, std::optional<std::string>>;
 		/// @brief	The underlying value type in opt3::Option.
 		using option_t = std::pair<std::string, std::optional<std::string>>;
+
+		/// @brief	The underlying value type in opt3::ParameterView.
+		using parameter_view_t = std::string_view;
+		/// @brief	The underlying value type in opt3::FlagView.
+		using flag_view_t = std::pair<char, std::optional<std::string_view>>;
+		/// @brief	The underlying value type in opt3::OptionView.
+		using option_view_t = std::pair<std::string_view, std::optional<std::string_view>>;
+
+		/// @brief	Transparent string hash that allows unordered containers keyed by std::string to be searched with a std::string_view, without constructing a string.
+		struct string_hash {
+			using is_transparent = void;
+			size_t operator()(std::string_view const& name) const noexcept { return std::hash<std::string_view>{}(name); }
+		};
+
+		/**
+		 * @struct		tracked_vector
+		 * @brief		A std::vector that counts the calls made to its non-const members, so that an index of its contents can tell when it's out-of-date.
+		 *\n			Every member that can modify the vector, or that returns a mutable reference or iterator into it, is counted whether or not anything changes.
+		 *\n			Modifications made through references or iterators that were obtained before the count was recorded can't be detected, and neither can
+		 *\n			 modifications made through a reference to the std::vector base.
+		 * @tparam T	The element type.
+		 */
+		template<typename T>
+		struct tracked_vector : public std::vector<T> {
+			using base_t = std::vector<T>;
+			using size_type = typename base_t::size_type;
+			using reference = typename base_t::reference;
+			using const_reference = typename base_t::const_reference;
+			using pointer = typename base_t::pointer;
+			using const_pointer = typename base_t::const_pointer;
+			using iterator = typename base_t::iterator;
+			using const_iterator = typename base_t::const_iterator;
+			using reverse_iterator = typename base_t::reverse_iterator;
+			using const_reverse_iterator = typename base_t::const_reverse_iterator;
+
+		private:
+			size_t modifications{ 0 };
+
+			/// @brief	Counts a call to a non-const member.
+			void touch() noexcept { ++modifications; }
+
+		public:
+			using base_t::base_t;
+
+			/// @returns	The number of calls made to non-const members so far. When this hasn't changed, neither have the contents.
+			size_t modification_count() const noexcept { return modifications; }
+
+		#pragma region access
+			reference operator[](size_type const pos) { touch(); return base_t::operator[](pos); }
+			const_reference operator[](size_type const pos) const { return base_t::operator[](pos); }
+			reference at(size_type const pos) { touch(); return base_t::at(pos); }
+			const_reference at(size_type const pos) const { return base_t::at(pos); }
+			reference front() { touch(); return base_t::front(); }
+			const_reference front() const { return base_t::front(); }
+			reference back() { touch(); return base_t::back(); }
+			const_reference back() const { return base_t::back(); }
+			pointer data() noexcept { touch(); return base_t::data(); }
+			const_pointer data() const noexcept { return base_t::data(); }
+
+			iterator begin() noexcept { touch(); return base_t::begin(); }
+			const_iterator begin() const noexcept { return base_t::begin(); }
+			iterator end() noexcept { touch(); return base_t::end(); }
+			const_iterator end() const noexcept { return base_t::end(); }
+			reverse_iterator rbegin() noexcept { touch(); return base_t::rbegin(); }
+			const_reverse_iterator rbegin() const noexcept { return base_t::rbegin(); }
+			reverse_iterator rend() noexcept { touch(); return base_t::rend(); }
+			const_reverse_iterator rend() const noexcept { return base_t::rend(); }
+		#pragma endregion access
+
+		#pragma region modifiers
+			template<typename... Ts> void assign(Ts&&... args) { touch(); base_t::assign(std::forward<Ts>(args)...); }
+			void assign(std::initializer_list<T> list) { touch(); base_t::assign(list); }
+			void clear() noexcept { touch(); base_t::clear(); }
+			template<typename... Ts> iterator insert(const_iterator pos, Ts&&... args) { touch(); return base_t::insert(pos, std::forward<Ts>(args)...); }
+			iterator insert(const_iterator pos, std::initializer_list<T> list) { touch(); return base_t::insert(pos, list); }
+			template<typename... Ts> iterator emplace(const_iterator pos, Ts&&... args) { touch(); return base_t::emplace(pos, std::forward<Ts>(args)...); }
+			iterator erase(const_iterator pos) { touch(); return base_t::erase(pos); }
+			iterator erase(const_iterator first, const_iterator last) { touch(); return base_t::erase(first, last); }
+			void push_back(T const& value) { touch(); base_t::push_back(value); }
+			void push_back(T&& value) { touch(); base_t::push_back(std::move(value)); }
+			template<typename... Ts> reference emplace_back(Ts&&... args) { touch(); return base_t::emplace_back(std::forward<Ts>(args)...); }
+			void pop_back() { touch(); base_t::pop_back(); }
+			void resize(size_type const count) { touch(); base_t::resize(count); }
+			void resize(size_type const count, T const& value) { touch(); base_t::resize(count, value); }
+			void swap(tracked_vector& other) noexcept { touch(); other.touch(); base_t::swap(other); }
+		#pragma endregion modifiers
+		};
 	}
 
 	/**
@@ -151,6 +247,48 @@ namespace opt3 {
 		 * @throws ex::except	This argument does not contain a captured value.
 		 */
 		CONSTEXPR std::string capture() const requires (var::any_same<T, _internal::flag_t, _internal::option_t>) { return _value.second.value(); }
+
+		/// @brief	Get the name of this argument.
+		CONSTEXPR std::string_view name() const requires (std::same_as<T, _internal::parameter_view_t>) { return _value; }
+		/// @brief	Get the name of this argument. The result refers to this instance, so it must not outlive it.
+		CONSTEXPR std::string_view name() const requires (std::same_as<T, _internal::flag_view_t>) { return{ &_value.first, 1ull }; }
+		/// @brief	Get the name of this argument.
+		CONSTEXPR std::string_view name() const requires (std::same_as<T, _internal::option_view_t>) { return _value.first; }
+
+		/// @brief	Get the capture value of this argument as its actual type.
+		CONSTEXPR std::optional<std::string_view> getValue() const requires(var::any_same<T, _internal::flag_view_t, _internal::option_view_t>) { return _value.second; }
+
+		/// @brief	Check if this argument has a captured value. (always returns false for parameters)
+		CONSTEXPR bool has_capture() const requires (std::same_as<T, _internal::parameter_view_t>) { return false; }
+		/// @brief	Check if this argument has a captured value.
+		CONSTEXPR bool has_capture() const requires (var::any_same<T, _internal::flag_view_t, _internal::option_view_t>) { return _value.second.has_value(); }
+
+		/**
+		 * @brief				Retrieve the capture value of this argument if it exists; otherwise returns the given string instead.
+		 * @param defaultValue	A string to return when a capture value is not available.
+		 * @returns				The captured value of this argument or defaultValue if one wasn't available.
+		 */
+		CONSTEXPR std::string_view capture_or(std::string_view const& defaultValue) const requires (var::any_same<T, _internal::flag_view_t, _internal::option_view_t>) { return _value.second.value_or(defaultValue); }
+		/**
+		 * @brief				Retrieve the capture value of this argument.
+		 * @returns				The captured value of this argument.
+		 * @throws ex::except	This argument does not contain a captured value.
+		 */
+		CONSTEXPR std::string_view capture() const requires (var::any_same<T, _internal::flag_view_t, _internal::option_view_t>) { return _value.second.value(); }
+
+		/**
+		 * @brief		Compare the name of this argument to the given name, without constructing a string.
+		 * @param name	The name to compare this argument to.
+		 * @returns		true when names match; otherwise false.
+		 */
+		CONSTEXPR bool compare_name(std::string_view const& name) const noexcept
+		{
+			if constexpr (var::any_same<T, _internal::flag_t, _internal::flag_view_t>)
+				return name.size() == 1ull && name.front() == _value.first;
+			else if constexpr (var::any_same<T, _internal::option_t, _internal::option_view_t>)
+				return name == _value.first;
+			else return name == _value;
+		}
 	};
 
 	/// @brief	Constraint that allows any types derived from base_arg.
@@ -163,6 +301,13 @@ namespace opt3 {
 	/// @brief	Option argument type; these are multi-character arguments that can capture values when enabled.
 	using Option = basic_arg_t<_internal::option_t>;
 
+	/// @brief	Non-owning Parameter argument type, which refers to the string it was parsed from. See parse_view().
+	using ParameterView = basic_arg_t<_internal::parameter_view_t>;
+	/// @brief	Non-owning Flag argument type, which refers to the string it was parsed from. See parse_view().
+	using FlagView = basic_arg_t<_internal::flag_view_t>;
+	/// @brief	Non-owning Option argument type, which refers to the string it was parsed from. See parse_view().
+	using OptionView = basic_arg_t<_internal::option_view_t>;
+
 	/**
 	 * @struct	variantarg
 	 * @brief	An abstraction wrapper around std::variant that directly exposes methods from the underlying basic_arg_t struct.
@@ -177,9 +322,18 @@ namespace opt3 {
 		 * @param name	The name to compare this argument to.
 		 * @returns		true when names match; otherwise false.
 		 */
-		WINCONSTEXPR bool compare_name(vstring const& name) const noexcept
+		WINCONSTEXPR bool compare_name(std::string_view const& name) const noexcept
 		{
-			return this->name() == name;
+			return std::visit([&name](auto&& value) -> bool { return value.compare_name(name); }, static_cast<base const&>(*this));
+		}
+		/**
+		 * @brief		Compare the name of this argument to the given single-character name.
+		 * @param name	The name to compare this argument to.
+		 * @returns		true when names match; otherwise false.
+		 */
+		WINCONSTEXPR bool compare_name(char const& name) const noexcept
+		{
+			return this->compare_name(std::string_view{ &name, 1ull });
 		}
 
 		/**
@@ -191,7 +345,7 @@ namespace opt3 {
 		template<typename TVisitor>
 		CONSTEXPR auto visit(const TVisitor& visitor) const noexcept
 		{
-			return std::visit(visitor, static_cast<base>(*this));
+			return std::visit(visitor, static_cast<base const&>(*this));
 		}
 
 		/**
@@ -368,10 +522,265 @@ namespace opt3 {
 	 *\n		This object contains the bulk of the code in the entire opt3 library.
 	 *\n		Additionally, this object and all derived types may be declared `const` without any loss of functionality, since commandline arguments are only parsed once.
 	 */
-	struct arg_container : public std::vector<variantarg> {
-		using base = std::vector<variantarg>;
+	struct arg_container : public _internal::tracked_vector<variantarg> {
+		using base = _internal::tracked_vector<variantarg>;
 		using base::base;
 
+	private:
+		/// @brief	Position returned by the query helpers when there's no match.
+		static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+		/// @brief	The positions of every argument, grouped by name & by type. See build_index().
+		struct index_t {
+			/// @brief	The positions of the arguments with each name, in ascending order.
+			std::unordered_map<std::string, std::vector<size_t>, _internal::string_hash, std::equal_to<>> names;
+			/// @brief	The positions of the arguments of each type, in ascending order. Indexed by the type's position in variantarg.
+			std::array<std::vector<size_t>, std::variant_size_v<variantarg::base>> types;
+			/// @brief	The modification count of the container when the index was built.
+			size_t modificationCount{ 0 };
+		};
+		/// @brief	The query index, when one has been built.
+		std::optional<index_t> index;
+
+		/// @returns	The position of argument type T within variantarg.
+		template<valid_arg T>
+		static constexpr size_t type_index() noexcept
+		{
+			if constexpr (std::same_as<T, Parameter>)
+				return 0ull;
+			else if constexpr (std::same_as<T, Flag>)
+				return 1ull;
+			else {
+				static_assert(std::same_as<T, Option>, "opt3::arg_container:  Invalid filter type specified!");
+				return 2ull;
+			}
+		}
+
+		/// @returns	true when arg is any of the filter types, or when no filter types were specified.
+		template<valid_arg... TFilterTypes>
+		static CONSTEXPR bool is_filter_type(variantarg const& arg) noexcept
+		{
+			if constexpr (sizeof...(TFilterTypes) == 0ull)
+				return true;
+			else return arg.is_any_type<TFilterTypes...>();
+		}
+
+		/// @brief	Predicate that matches any argument.
+		static CONSTEXPR bool any_arg(variantarg const&) noexcept { return true; }
+
+		/// @returns	The capture value of arg, or its name when it's a Parameter.
+		static std::string value_of(variantarg const& arg) noexcept(false)
+		{
+			return arg.is_type<Parameter>() ? arg.name() : arg.capture();
+		}
+
+		/// @brief	Converts the names passed to a query method to strings once, instead of every time they're compared.
+		template<var::same_or_convertible<vstring>... Ts>
+		static std::array<vstring, sizeof...(Ts)> make_keys(Ts&&... names)
+		{
+			return{ vstring{ std::forward<Ts>(names) }... };
+		}
+
+		/// @returns	The index if it has been built and the container hasn't been accessed through a non-const member since; otherwise nullptr.
+		const index_t* current_index() const noexcept
+		{
+			return index.has_value() && index->modificationCount == this->modification_count() ? &index.value() : nullptr;
+		}
+		/// @returns	The index if it has been built and the container hasn't been accessed through a non-const member since.
+		const index_t& require_index(std::string_view const& function) const noexcept(false)
+		{
+			if (const auto* const idx{ current_index() })
+				return *idx;
+			throw make_exception(function, "() failed:  The index is missing or out-of-date; call build_index() first!");
+		}
+
+		/**
+		 * @brief		Calls func with each list of positions that can contain matches for a query; one list per name, or one per filter type when there aren't any names.
+		 * @param names	The names to search for.  When empty, all names are considered matching.
+		 * @param func	A function that accepts a std::span<const size_t>.
+		 * @returns		false when the index can't narrow down the query, and every argument has to be checked instead; otherwise true.
+		 */
+		template<valid_arg... TFilterTypes, typename TFunc>
+		bool visit_candidates(std::span<const vstring> const& names, TFunc const& func) const
+		{
+			const auto* const idx{ current_index() };
+			if (idx == nullptr)
+				return false;
+			if (!names.empty()) {
+				for (const auto& name : names)
+					if (const auto& it{ idx->names.find(std::string_view{ name }) }; it != idx->names.end())
+						func(std::span<const size_t>{ it->second });
+				return true;
+			}
+			if constexpr (sizeof...(TFilterTypes) != 0ull) {
+				(func(std::span<const size_t>{ idx->types[type_index<TFilterTypes>()] }), ...);
+				return true;
+			}
+			else return false;
+		}
+
+		/**
+		 * @brief			Gets the position of the first matching argument.
+		 * @tparam Reverse	When true, the last matching argument is returned instead.
+		 * @param names		The names to search for.  When empty, all names are considered matching.
+		 * @param pred		A predicate that matching arguments must also satisfy.
+		 * @returns			The position of the matching argument if found; otherwise npos.
+		 */
+		template<bool Reverse, valid_arg... TFilterTypes, std::predicate<variantarg> TPredicate>
+		size_t first_match(std::span<const vstring> const& names, TPredicate const& pred) const
+		{
+			const auto& is_match{ [this, &pred](size_t const& i) { return is_filter_type<TFilterTypes...>((*this)[i]) && pred((*this)[i]); } };
+
+			size_t result{ npos };
+			// each list is sorted, so it only has to be searched until it passes the best match found so far
+			const bool indexed{ visit_candidates<TFilterTypes...>(names, [&result, &is_match](std::span<const size_t> const& positions) {
+				if constexpr (Reverse) {
+					for (auto it{ positions.rbegin() }, end{ positions.rend() }; it != end && (result == npos || *it > result); ++it) {
+						if (is_match(*it)) {
+							result = *it;
+							break;
+						}
+					}
+				}
+				else {
+					for (auto it{ positions.begin() }, end{ positions.end() }; it != end && *it < result; ++it) {
+						if (is_match(*it)) {
+							result = *it;
+							break;
+						}
+					}
+				}
+			}) };
+			if (indexed)
+				return result;
+
+			for (size_t n{ 0 }, size{ this->size() }; n < size; ++n) {
+				const size_t i{ Reverse ? size - 1ull - n : n };
+				if (is_match(i) && (names.empty() || std::ranges::any_of(names, [&arg = (*this)[i]](auto&& name) { return arg.compare_name(name); })))
+					return i;
+			}
+			return npos;
+		}
+		/**
+		 * @brief			Gets the positions of all matching arguments.
+		 * @param names		The names to search for.  When empty, all names are considered matching.
+		 * @param pred		A predicate that matching arguments must also satisfy.
+		 * @returns			The positions of the matching arguments, in ascending order.
+		 */
+		template<valid_arg... TFilterTypes, std::predicate<variantarg> TPredicate>
+		std::vector<size_t> all_matches(std::span<const vstring> const& names, TPredicate const& pred) const
+		{
+			const auto& is_match{ [this, &pred](size_t const& i) { return is_filter_type<TFilterTypes...>((*this)[i]) && pred((*this)[i]); } };
+
+			std::vector<size_t> vec;
+			size_t lists{ 0 };
+			const bool indexed{ visit_candidates<TFilterTypes...>(names, [&vec, &lists, &is_match](std::span<const size_t> const& positions) {
+				++lists;
+				for (const auto& i : positions)
+					if (is_match(i))
+						vec.emplace_back(i);
+			}) };
+			if (indexed) {
+				// matches from separate lists are interleaved, and the same name or type may have been specified more than once
+				if (lists > 1ull) {
+					std::ranges::sort(vec);
+					vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+				}
+				return vec;
+			}
+
+			for (size_t i{ 0 }, size{ this->size() }; i < size; ++i)
+				if (is_match(i) && (names.empty() || std::ranges::any_of(names, [&arg = (*this)[i]](auto&& name) { return arg.compare_name(name); })))
+					vec.emplace_back(i);
+			return vec;
+		}
+
+		/// @returns	An iterator to the argument at position i, or the ending iterator when i is npos.
+		std::vector<variantarg>::const_iterator iterator_at(size_t const& i) const noexcept
+		{
+			return i == npos ? this->end() : this->begin() + i;
+		}
+		/// @returns	A reverse iterator to the argument at position i, or the reverse ending iterator when i is npos.
+		std::vector<variantarg>::const_reverse_iterator reverse_iterator_at(size_t const& i) const noexcept
+		{
+			return i == npos ? this->rend() : this->rbegin() + (this->size() - 1ull - i);
+		}
+
+	public:
+	#pragma region index
+		/**
+		 * @brief	Builds an index of the positions of every argument by name & by type, which the query methods use instead of checking every argument.
+		 *\n		parse() builds the index automatically. Any non-const access to the container afterwards (adding, removing, replacing or sorting arguments,
+		 *\n		 or just getting a mutable reference or iterator) makes the index out-of-date, and queries check every argument until this is called again.
+		 *\n		Declare the container const, or use std::as_const(), to read it without doing so.
+		 */
+		void build_index()
+		{
+			const auto& args{ std::as_const(*this) };
+			index_t idx;
+			for (size_t i{ 0 }; i < args.size(); ++i) {
+				const auto& arg{ args[i] };
+				idx.types[arg.index()].emplace_back(i);
+				idx.names[arg.name()].emplace_back(i);
+			}
+			idx.modificationCount = args.modification_count();
+			index = std::move(idx);
+		}
+		/**
+		 * @brief		Checks if the index is available.
+		 * @returns		true when the index was built and the container hasn't been accessed through a non-const member since; otherwise false.
+		 */
+		bool is_indexed() const noexcept { return current_index() != nullptr; }
+
+		/**
+		 * @brief				Gets the positions of all arguments with the specified name, without searching or copying anything.
+		 * @param name			The name of the target argument(s) (Excluding prefix dashes).
+		 * @returns				The positions of the matching arguments in ascending order. This refers to the index, so it's invalidated by build_index().
+		 * @throws ex::except	The index is missing or out-of-date.
+		 */
+		std::span<const size_t> positions_of(std::string_view const& name) const noexcept(false)
+		{
+			const auto& idx{ require_index("positions_of") };
+			if (const auto& it{ idx.names.find(name) }; it != idx.names.end())
+				return it->second;
+			return{};
+		}
+		/**
+		 * @brief				Gets the positions of all arguments with the specified single-character name, without searching or copying anything.
+		 * @param name			The name of the target argument(s) (Excluding prefix dashes).
+		 * @returns				The positions of the matching arguments in ascending order. This refers to the index, so it's invalidated by build_index().
+		 * @throws ex::except	The index is missing or out-of-date.
+		 */
+		std::span<const size_t> positions_of(char const& name) const noexcept(false) { return this->positions_of(std::string_view{ &name, 1ull }); }
+		/**
+		 * @brief				Gets the positions of all arguments of the specified type, without searching or copying anything.
+		 * @tparam T			The type of the target arguments.
+		 * @returns				The positions of the matching arguments in ascending order. This refers to the index, so it's invalidated by build_index().
+		 * @throws ex::except	The index is missing or out-of-date.
+		 */
+		template<valid_arg T>
+		std::span<const size_t> positions_of() const noexcept(false)
+		{
+			return require_index("positions_of").types[type_index<T>()];
+		}
+
+		/**
+		 * @brief					Counts the arguments that match any of the specified names.
+		 * @tparam TFilterTypes...	Any number of types to limit the counted types to.  When left empty, all types are considered matching.
+		 * @param names				The name(s) of the target argument(s) (Excluding prefix dashes).  When left empty, all names are considered matching.
+		 * @returns					The number of matching arguments.
+		 */
+		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
+		size_t count(Ts&&... names) const
+		{
+			if constexpr (sizeof...(Ts) == 1ull && sizeof...(TFilterTypes) == 0ull) {
+				if (this->is_indexed())
+					return this->positions_of(vstring{ std::forward<Ts>(names)... }).size();
+			}
+			return this->all_matches<TFilterTypes...>(make_keys(std::forward<Ts>(names)...), any_arg).size();
+		}
+	#pragma endregion index
+
 	#pragma region subvec
 		/**
 		 * @brief			Retrieves (copies) the specified segment of this argument container into a new instance.
@@ -395,6 +804,28 @@ namespace opt3 {
 				throw make_exception("subvec() failed:  Cannot create a subvec with a total of 0 elements!");
 			return arg_container{ this->begin() + off, this->begin() + (off + count) };
 		}
+		/**
+		 * @brief			Gets a view of the specified segment of this argument container, without copying it.
+		 * @param begin		(Inclusive) An iterator pointing to the first element in the subspan.
+		 * @param end		(Exclusive) An iterator pointing to the element AFTER the last element in the subspan.
+		 * @returns			A span that refers to the specified segment; it's invalidated when the container is modified.
+		 */
+		std::span<const variantarg> subspan(const std::vector<variantarg>::const_iterator& begin, const std::vector<variantarg>::const_iterator& end) const noexcept
+		{
+			return{ begin, end };
+		}
+		/**
+		 * @brief			Gets a view of the specified segment of this argument container, without copying it.
+		 * @param off		The index of the first element in the subspan.
+		 * @param count		The total number of elements to include in the subspan. (Default: 1)
+		 * @returns			A span that refers to the specified segment; it's invalidated when the container is modified.
+		 */
+		std::span<const variantarg> subspan(const size_t& off, const size_t& count = 1ull) const noexcept(false)
+		{
+			if (off > this->size() || count > this->size() - off)
+				throw make_exception("subspan() failed:  Segment [", off, ", ", off + count, ") is out of range for a container of size ", this->size(), '!');
+			return std::span<const variantarg>{ this->data() + off, count };
+		}
 	#pragma endregion subvec
 
 	#pragma region find_if
@@ -406,13 +837,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg> TPredicate>
 		WINCONSTEXPR std::vector<variantarg>::const_iterator find_if(const TPredicate& pred) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && pred(*it)) {
-					return it;
-				}
-			}
-			return this->end();
+			return this->iterator_at(this->first_match<false, TFilterTypes...>({}, pred));
 		}
 		/**
 		 * @brief			Finds the first element for which any of the given predicates return true.
@@ -422,11 +847,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg>... TPredicates>
 		WINCONSTEXPR std::vector<variantarg>::const_iterator find_if_any(const TPredicates&... preds) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it)
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && var::variadic_or(preds(*it)...))
-					return it;
-			return this->end();
+			return this->iterator_at(this->first_match<false, TFilterTypes...>({}, [&preds...](variantarg const& arg) { return var::variadic_or(preds(arg)...); }));
 		}
 		/**
 		 * @brief			Finds the first element for which all of the given predicates return true.
@@ -436,11 +857,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg>... TPredicates>
 		WINCONSTEXPR std::vector<variantarg>::const_iterator find_if_all(const TPredicates&... preds) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it)
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && var::variadic_and(preds(*it)...))
-					return it;
-			return this->end();
+			return this->iterator_at(this->first_match<false, TFilterTypes...>({}, [&preds...](variantarg const& arg) { return var::variadic_and(preds(arg)...); }));
 		}
 	#pragma endregion find_if
 
@@ -453,13 +870,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg> TPredicate>
 		WINCONSTEXPR std::vector<variantarg>::const_reverse_iterator rfind_if(const TPredicate& pred) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && pred(*it)) {
-					return it;
-				}
-			}
-			return this->rend();
+			return this->reverse_iterator_at(this->first_match<true, TFilterTypes...>({}, pred));
 		}
 		/**
 		 * @brief			Finds the first element for which any of the given predicates return true.
@@ -469,11 +880,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg>... TPredicates>
 		WINCONSTEXPR std::vector<variantarg>::const_reverse_iterator rfind_if_any(const TPredicates&... preds) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it)
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && var::variadic_or(preds(*it)...))
-					return it;
-			return this->rend();
+			return this->reverse_iterator_at(this->first_match<true, TFilterTypes...>({}, [&preds...](variantarg const& arg) { return var::variadic_or(preds(arg)...); }));
 		}
 		/**
 		 * @brief			Finds the first element for which all of the given predicates return true.
@@ -483,11 +890,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, std::predicate<variantarg>... TPredicates>
 		WINCONSTEXPR std::vector<variantarg>::const_reverse_iterator rfind_if_all(const TPredicates&... preds) const
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it)
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && var::variadic_and(preds(*it)...))
-					return it;
-			return this->rend();
+			return this->reverse_iterator_at(this->first_match<true, TFilterTypes...>({}, [&preds...](variantarg const& arg) { return var::variadic_and(preds(arg)...); }));
 		}
 	#pragma endregion rfind_if
 
@@ -495,44 +898,21 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes>
 		WINCONSTEXPR std::vector<variantarg>::const_iterator find(vstring const& name) const noexcept
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name)) {
-					return it;
-				}
-			}
-			return this->end();
+			return this->iterator_at(this->first_match<false, TFilterTypes...>({ &name, 1ull }, any_arg));
 		}
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		WINCONSTEXPR std::vector<variantarg>::const_iterator find_any(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && (match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...))) {
-					return it;
-				}
-			}
-			return this->end();
+			return this->iterator_at(this->first_match<false, TFilterTypes...>(make_keys(std::forward<Ts>(names)...), any_arg));
 		}
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		WINCONSTEXPR std::vector<std::vector<variantarg>::const_iterator> find_all(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
+			const auto& positions{ this->all_matches<TFilterTypes...>(make_keys(std::forward<Ts>(names)...), any_arg) };
 			std::vector<std::vector<variantarg>::const_iterator> vec;
-			constexpr size_t block_size{ sizeof...(names) };
-			vec.reserve(block_size);
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && (match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...))) {
-					vec.emplace_back(it);
-					if (vec.size() == vec.capacity())// increase capacity:
-						vec.reserve(vec.size() + block_size);
-				}
-			}
-			vec.shrink_to_fit();
+			vec.reserve(positions.size());
+			for (const auto& i : positions)
+				vec.emplace_back(this->begin() + i);
 			return vec;
 		}
 	#pragma endregion find
@@ -541,44 +921,21 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes>
 		WINCONSTEXPR std::vector<variantarg>::const_reverse_iterator rfind(vstring const& name) const noexcept
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name)) {
-					return it;
-				}
-			}
-			return this->rend();
+			return this->reverse_iterator_at(this->first_match<true, TFilterTypes...>({ &name, 1ull }, any_arg));
 		}
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		WINCONSTEXPR std::vector<variantarg>::const_reverse_iterator rfind_any(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && (match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...))) {
-					return it;
-				}
-			}
-			return this->rend();
+			return this->reverse_iterator_at(this->first_match<true, TFilterTypes...>(make_keys(std::forward<Ts>(names)...), any_arg));
 		}
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		WINCONSTEXPR std::vector<std::vector<variantarg>::const_reverse_iterator> rfind_all(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
+			const auto& positions{ this->all_matches<TFilterTypes...>(make_keys(std::forward<Ts>(names)...), any_arg) };
 			std::vector<std::vector<variantarg>::const_reverse_iterator> vec;
-			constexpr size_t block_size{ sizeof...(names) };
-			vec.reserve(block_size);
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && (match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...))) {
-					vec.emplace_back(it);
-					if (vec.size() == vec.capacity())// increase capacity:
-						vec.reserve(vec.size() + block_size);
-				}
-			}
-			vec.shrink_to_fit();
+			vec.reserve(positions.size());
+			for (auto it{ positions.rbegin() }, end{ positions.rend() }; it != end; ++it)
+				vec.emplace_back(this->reverse_iterator_at(*it));
 			return vec;
 		}
 	#pragma endregion rfind
@@ -641,7 +998,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes>
 		CONSTEXPR std::optional<variantarg> rget(vstring const& name) const noexcept
 		{
-			if (const auto& it{ this->rfind<TFilterTypes...>(name) }; it != this->end())
+			if (const auto& it{ this->rfind<TFilterTypes...>(name) }; it != this->rend())
 				return *it;
 			return std::nullopt;
 		}
@@ -655,7 +1012,7 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		CONSTEXPR std::optional<variantarg> rget_any(Ts&&... names) const noexcept
 		{
-			if (const auto& it{ this->rfind_any<TFilterTypes...>(std::forward<Ts>(names)...) }; it != this->end())
+			if (const auto& it{ this->rfind_any<TFilterTypes...>(std::forward<Ts>(names)...) }; it != this->rend())
 				return *it;
 			return std::nullopt;
 		}
@@ -691,16 +1048,8 @@ namespace opt3 {
 		CONSTEXPR std::optional<std::string> getv(vstring const& name) const noexcept
 		{
 			static_assert(!var::any_same<Parameter, TFilterTypes...>, "opt3::arg_container::getv() cannot be used to get non-Flags or non-Options!");
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if (!it->has_capture()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name)) {
-					if (it->is_type<Parameter>())
-						return it->name();
-					else
-						return it->capture();
-				}
-			}
+			if (const size_t i{ this->first_match<false, TFilterTypes...>({ &name, 1ull }, [](variantarg const& arg) { return arg.has_capture(); }) }; i != npos)
+				return value_of((*this)[i]);
 			return std::nullopt;
 		}
 		/**
@@ -714,18 +1063,8 @@ namespace opt3 {
 		CONSTEXPR std::optional<std::string> getv_any(Ts&&... names) const noexcept
 		{
 			static_assert(!var::any_same<Parameter, TFilterTypes...>, "opt3::arg_container::getv() cannot be used to get non-Flags or non-Options!");
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if (!it->has_capture()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && ((match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...)))) {
-					if (it->is_type<Parameter>())
-						return it->name();
-					else
-						return it->capture();
-				}
-			}
+			if (const size_t i{ this->first_match<false, TFilterTypes...>(make_keys(std::forward<Ts>(names)...), [](variantarg const& arg) { return arg.has_capture(); }) }; i != npos)
+				return value_of((*this)[i]);
 			return std::nullopt;
 		}
 		/**
@@ -738,24 +1077,11 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		CONSTEXPR std::vector<std::string> getv_all(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
+			const auto& positions{ this->all_matches<TFilterTypes...>(make_keys(std::forward<Ts>(names)...), [](variantarg const& arg) { return arg.has_capture() || arg.is_type<Parameter>(); }) };
 			std::vector<std::string> vec;
-			constexpr size_t block_size{ sizeof...(Ts) };
-			vec.reserve(block_size);
-			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it) {
-				if (!it->has_capture() && !it->is_type<Parameter>()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && ((match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...)))) {
-					if (it->is_type<Parameter>())
-						vec.emplace_back(it->name());
-					else
-						vec.emplace_back(it->capture());
-					if (vec.size() == vec.capacity())
-						vec.reserve(vec.size() + block_size);
-				}
-			}
-			vec.shrink_to_fit();
+			vec.reserve(positions.size());
+			for (const auto& i : positions)
+				vec.emplace_back(value_of((*this)[i]));
 			return vec;
 		}
 	#pragma endregion getv
@@ -771,16 +1097,8 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes>
 		CONSTEXPR std::optional<std::string> rgetv(vstring const& name) const noexcept
 		{
-			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if (!it->has_capture()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name)) {
-					if (it->is_type<Parameter>())
-						return it->name();
-					else
-						return it->capture();
-				}
-			}
+			if (const size_t i{ this->first_match<true, TFilterTypes...>({ &name, 1ull }, [](variantarg const& arg) { return arg.has_capture(); }) }; i != npos)
+				return value_of((*this)[i]);
 			return std::nullopt;
 		}
 		/**
@@ -793,18 +1111,8 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		CONSTEXPR std::optional<std::string> rgetv_any(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if (!it->has_capture()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && ((match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...)))) {
-					if (it->is_type<Parameter>())
-						return it->name();
-					else
-						return it->capture();
-				}
-			}
+			if (const size_t i{ this->first_match<true, TFilterTypes...>(make_keys(std::forward<Ts>(names)...), [](variantarg const& arg) { return arg.has_capture(); }) }; i != npos)
+				return value_of((*this)[i]);
 			return std::nullopt;
 		}
 		/**
@@ -817,24 +1125,11 @@ namespace opt3 {
 		template<valid_arg... TFilterTypes, var::same_or_convertible<vstring>... Ts>
 		CONSTEXPR std::vector<std::string> rgetv_all(Ts&&... names) const noexcept
 		{
-			constexpr bool
-				match_any_type{ sizeof...(TFilterTypes) == 0ull },
-				match_any_name{ sizeof...(Ts) == 0ull };
+			const auto& positions{ this->all_matches<TFilterTypes...>(make_keys(std::forward<Ts>(names)...), [](variantarg const& arg) { return arg.has_capture(); }) };
 			std::vector<std::string> vec;
-			constexpr size_t block_size{ sizeof...(Ts) };
-			vec.reserve(block_size);
-			for (auto it{ this->rbegin() }, end{ this->rend() }; it != end; ++it) {
-				if (!it->has_capture()) continue;
-				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && ((match_any_name || var::variadic_or(it->compare_name(std::forward<Ts>(names))...)))) {
-					if (it->is_type<Parameter>())
-						vec.emplace_back(it->name());
-					else
-						vec.emplace_back(it->capture());
-					if (vec.size() == vec.capacity())
-						vec.reserve(vec.size() + block_size);
-				}
-			}
-			vec.shrink_to_fit();
+			vec.reserve(positions.size());
+			for (auto it{ positions.rbegin() }, end{ positions.rend() }; it != end; ++it)
+				vec.emplace_back(value_of((*this)[*it]));
 			return vec;
 		}
 	#pragma endregion rgetv
@@ -1187,77 +1482,266 @@ namespace opt3 {
 	#pragma endregion get_duplicates
 	};
 
-	/// @brief	unsigned char type
-	using uchar = unsigned char;
-
-#pragma region Enums
-	/**
-	 * @enum	CaptureStyle
-	 * @brief	Defines various argument capturing styles
-	 */
-	$make_typed_bitfield(CaptureStyle, uchar,
-						 /// @brief	No captures are allowed under any circumstances. If a capture is appended using an equals ('=') sign, the capture string is inserted into the argument list as a parameter as if the equals sign was replaced with a space on the commandline.
-						 Disabled = 0,
-						 /// @brief	Captures are only allowed when appended to the argument using an equals ('=') sign. Since CaptureStyle is a bitfield, this may be combined with CaptureStyle::Optional or CaptureStyle::Required to force them to only accept input via appending with an equals sign ('=').
-						 EqualsOnly = 1,
-						 /// @brief	Captures whenever possible, but does not require capture input. Arguments of type Flag & Option are never captured by other flags or options.
-						 Optional = 2,
-						 /// @brief	Requires capture input. If a capture is not provided, an exception is thrown by the parser that includes the name of the argument, and a brief message informing the user to provide a capture argument.
-						 Required = 4,
-						 );
-
-	/**
-	 * @enum	ConflictStyle
-	 * @brief	Determines the circumstances in which two arguments from the same template group will conflict with each other.
-	 */
-	enum class ConflictStyle : uchar {
-		/// @brief	Arguments do not conflict.
-		None = 0,
-		/// @brief	Both arguments can be present at the same time, but **only one** is allowed to capture, otherwise a conflict exception is thrown.
-		CapturesConflict = 1,
-		/// @brief	Only one of the arguments can be present at the same time.
-		Conflict = 2,
-	};
-#pragma endregion Enums
-
-	/**
-	 * @brief
-	 * @tparam T
-	 */
-	template<var::any_same<_internal::flag_t, _internal::option_t> T>
-	struct basic_arg_template : public base_arg {
-		vstring name;
-		std::optional<CaptureStyle> captureStyle;
-
-		CONSTEXPR basic_arg_template(vstring const& name, const std::optional<CaptureStyle>& captureStyle = std::nullopt) : name{ name }, captureStyle{ captureStyle } {}
-	};
-
-	/// @brief		An argument template for `Option`s.
-	using TemplateOption = basic_arg_template<_internal::option_t>;
-	/// @brief		An argument template for `Flag`s.
-	using TemplateFlag = basic_arg_template<_internal::flag_t>;
-
 	/**
-	 * @struct	variant_template
-	 * @brief	An abstraction wrapper around `basic_arg_template` that accepts types `TemplateOption` & `TemplateFlag`
+	 * @struct	variantarg_view
+	 * @brief	The non-owning counterpart of variantarg, which refers to the strings it was parsed from instead of copying them.
+	 *\n		Instances are created by parse_view(), and are only valid for as long as the parsed strings are.
 	 */
-	class variant_template : public std::variant<TemplateFlag, TemplateOption> {
-	protected:
-		using base_t = std::variant<TemplateFlag, TemplateOption>;
-
-	public:
-		template<typename... Ts> requires std::constructible_from<base_t, Ts...> CONSTEXPR variant_template(Ts&&... args) : base_t(std::forward<Ts>(args)...) {}
+	struct variantarg_view : public std::variant<ParameterView, FlagView, OptionView> {
+		using base = std::variant<ParameterView, FlagView, OptionView>;
+		using base::base;
 
 		/**
-		 * @brief
-		 * @tparam TVisitor
+		 * @brief				Calls the given visitor with the argument contained by this instance.
+		 * @param visitor		A function or lambda that accepts ParameterView, FlagView, and OptionView.
+		 * @returns				The value returned by the visitor function.
+		 */
+		template<typename TVisitor>
+		CONSTEXPR auto visit(const TVisitor& visitor) const
+		{
+			return std::visit(visitor, static_cast<base const&>(*this));
+		}
+
+		/**
+		 * @brief		Gets the name of this argument.
+		 * @returns		The name of this argument, excluding any prefixes that were stripped during parsing. The name of a Flag refers to this instance, so it must not outlive it.
+		 */
+		CONSTEXPR std::string_view name() const noexcept
+		{
+			return this->visit([](auto&& value) -> std::string_view { return value.name(); });
+		}
+		/**
+		 * @brief		Directly gets the capture value of this argument; or std::nullopt for Parameter types.
+		 * @returns		The captured value of this argument if it has one; otherwise std::nullopt.
+		 */
+		CONSTEXPR std::optional<std::string_view> getValue() const noexcept
+		{
+			return this->visit([](auto&& value) -> std::optional<std::string_view> {
+				if constexpr (std::same_as<std::decay_t<decltype(value)>, ParameterView>)
+					return std::nullopt;
+				else return value.getValue();
+			});
+		}
+		/**
+		 * @brief		Checks if this argument has a captured value.
+		 * @returns		true when this argument has a captured value; otherwise false.
+		 */
+		CONSTEXPR bool has_capture() const noexcept
+		{
+			return this->visit([](auto&& value) -> bool { return value.has_capture(); });
+		}
+		/**
+		 * @brief				Gets the capture value of this argument if it exists; otherwise returns the given string instead.
+		 * @param defaultValue	The default string value to return when this argument doesn't have a capture value.
+		 * @returns				std::string_view
+		 */
+		CONSTEXPR std::string_view capture_or(std::string_view const& defaultValue) const noexcept
+		{
+			return this->getValue().value_or(defaultValue);
+		}
+		/**
+		 * @brief				Gets the capture value of this argument.
+		 * @returns				The capture value of this argument.
+		 * @throws ex::except	This argument is a Parameter.
+		 */
+		std::string_view capture() const noexcept(false)
+		{
+			if (this->is_type<ParameterView>())
+				throw make_exception("opt3::variantarg_view:  Cannot retrieve capture value from an argument of type parameter!");
+			return this->getValue().value();
+		}
+
+		/**
+		 * @brief		Compare the name of this argument to the given name.
+		 * @param name	The name to compare this argument to.
+		 * @returns		true when names match; otherwise false.
+		 */
+		CONSTEXPR bool compare_name(std::string_view const& name) const noexcept
+		{
+			return this->name() == name;
+		}
+
+		/// @brief	Check if this variantarg_view instance's type is the same as a given type.
+		template<valid_arg T> CONSTEXPR bool is_type() const noexcept { return std::holds_alternative<T>(*this); }
+		/// @brief	Check if this variantarg_view instance's type is the same as any of the given types.
+		template<valid_arg... Ts> CONSTEXPR bool is_any_type() const noexcept { return var::variadic_or(std::holds_alternative<Ts>(*this)...); }
+
+		/**
+		 * @brief		Copies this argument into an owning variantarg.
+		 * @returns		A variantarg with the same type, name & capture value as this instance.
+		 */
+		variantarg to_variantarg() const
+		{
+			return this->visit([](auto&& value) -> variantarg {
+				using T = std::decay_t<decltype(value)>;
+
+				if constexpr (std::same_as<T, ParameterView>)
+					return Parameter{ std::string{ value.name() } };
+				else {
+					std::optional<std::string> capture{ std::nullopt };
+					if (const auto& v{ value.getValue() }; v.has_value())
+						capture.emplace(v.value());
+					if constexpr (std::same_as<T, FlagView>)
+						return Flag{ std::make_pair(value.name().front(), std::move(capture)) };
+					else return Option{ std::make_pair(std::string{ value.name() }, std::move(capture)) };
+				}
+			});
+		}
+	};
+
+	/**
+	 * @struct	arg_view_container
+	 * @brief	The non-owning counterpart of arg_container, which is returned by parse_view().
+	 *\n		Only the most common queries are provided; use to_arg_container() to get the full arg_container interface.
+	 */
+	struct arg_view_container : public std::vector<variantarg_view> {
+		using base = std::vector<variantarg_view>;
+		using base::base;
+
+		/**
+		 * @brief					Finds the first argument with the given name.
+		 * @tparam TFilterTypes...	Any number of types to limit the results to.  When left empty, all types are considered matching.
+		 * @param name				The name of the argument to search for.
+		 * @returns					An iterator to the first matching argument, or the ending iterator if no matches were found.
+		 */
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR const_iterator find(std::string_view const& name) const noexcept
+		{
+			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
+			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it)
+				if ((match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name))
+					return it;
+			return this->end();
+		}
+		/// @brief	Finds the first argument with the given single-character name.
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR const_iterator find(char const& name) const noexcept { return this->find<TFilterTypes...>(std::string_view{ &name, 1ull }); }
+
+		/**
+		 * @brief					Checks if the specified argument was included or not.
+		 * @tparam TFilterTypes...	Any number of types to limit the results to.  When left empty, all types are considered matching.
+		 * @param name				The name of the argument to check for (Excluding prefix dashes).
+		 * @returns					true when the argument was included; otherwise false.
+		 */
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR bool check(std::string_view const& name) const noexcept { return this->find<TFilterTypes...>(name) != this->end(); }
+		/// @brief	Checks if the specified single-character argument was included or not.
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR bool check(char const& name) const noexcept { return this->find<TFilterTypes...>(name) != this->end(); }
+		/// @brief	Checks if the specified Option was included.
+		CONSTEXPR bool checkopt(std::string_view const& name) const noexcept { return this->check<OptionView>(name); }
+		/// @brief	Checks if the specified Flag was included.
+		CONSTEXPR bool checkflag(char const& name) const noexcept { return this->check<FlagView>(name); }
+		/// @brief	Checks if the specified Parameter was included.
+		CONSTEXPR bool checkparam(std::string_view const& name) const noexcept { return this->check<ParameterView>(name); }
+
+		/**
+		 * @brief					Gets the captured value from the first matching argument.
+		 *\n						Only arguments with values are considered to be matching, all other arguments are skipped; including if their name does match.
+		 * @tparam TFilterTypes...	Any number of types to limit the results to.  When left empty, all types are considered matching.
+		 * @param name				The name of the argument to search for.
+		 * @returns					The capture value of the first matching argument if found; otherwise std::nullopt.
+		 */
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR std::optional<std::string_view> getv(std::string_view const& name) const noexcept
+		{
+			static_assert(!var::any_same<ParameterView, TFilterTypes...>, "opt3::arg_view_container::getv() cannot be used to get non-Flags or non-Options!");
+			constexpr bool match_any_type{ sizeof...(TFilterTypes) == 0ull };
+			for (auto it{ this->begin() }, end{ this->end() }; it != end; ++it)
+				if (it->has_capture() && (match_any_type || it->is_any_type<TFilterTypes...>()) && it->compare_name(name))
+					return it->getValue();
+			return std::nullopt;
+		}
+		/// @brief	Gets the captured value from the first matching single-character argument.
+		template<valid_arg... TFilterTypes>
+		CONSTEXPR std::optional<std::string_view> getv(char const& name) const noexcept { return this->getv<TFilterTypes...>(std::string_view{ &name, 1ull }); }
+
+		/**
+		 * @brief		Copies the arguments into an owning arg_container.
+		 * @returns		A new arg_container instance with a copy of every argument, in the same order.
+		 */
+		arg_container to_arg_container() const
+		{
+			arg_container cont;
+			cont.reserve(this->size());
+			for (const auto& arg : *this)
+				cont.emplace_back(arg.to_variantarg());
+			cont.build_index();
+			return cont;
+		}
+	};
+
+	/// @brief	unsigned char type
+	using uchar = unsigned char;
+
+#pragma region Enums
+	/**
+	 * @enum	CaptureStyle
+	 * @brief	Defines various argument capturing styles
+	 */
+	$make_typed_bitfield(CaptureStyle, uchar,
+						 /// @brief	No captures are allowed under any circumstances. If a capture is appended using an equals ('=') sign, the capture string is inserted into the argument list as a parameter as if the equals sign was replaced with a space on the commandline.
+						 Disabled = 0,
+						 /// @brief	Captures are only allowed when appended to the argument using an equals ('=') sign. Since CaptureStyle is a bitfield, this may be combined with CaptureStyle::Optional or CaptureStyle::Required to force them to only accept input via appending with an equals sign ('=').
+						 EqualsOnly = 1,
+						 /// @brief	Captures whenever possible, but does not require capture input. Arguments of type Flag & Option are never captured by other flags or options.
+						 Optional = 2,
+						 /// @brief	Requires capture input. If a capture is not provided, an exception is thrown by the parser that includes the name of the argument, and a brief message informing the user to provide a capture argument.
+						 Required = 4,
+						 );
+
+	/**
+	 * @enum	ConflictStyle
+	 * @brief	Determines the circumstances in which two arguments from the same template group will conflict with each other.
+	 */
+	enum class ConflictStyle : uchar {
+		/// @brief	Arguments do not conflict.
+		None = 0,
+		/// @brief	Both arguments can be present at the same time, but **only one** is allowed to capture, otherwise a conflict exception is thrown.
+		CapturesConflict = 1,
+		/// @brief	Only one of the arguments can be present at the same time.
+		Conflict = 2,
+	};
+#pragma endregion Enums
+
+	/**
+	 * @brief
+	 * @tparam T
+	 */
+	template<var::any_same<_internal::flag_t, _internal::option_t> T>
+	struct basic_arg_template : public base_arg {
+		vstring name;
+		std::optional<CaptureStyle> captureStyle;
+
+		CONSTEXPR basic_arg_template(vstring const& name, const std::optional<CaptureStyle>& captureStyle = std::nullopt) : name{ name }, captureStyle{ captureStyle } {}
+	};
+
+	/// @brief		An argument template for `Option`s.
+	using TemplateOption = basic_arg_template<_internal::option_t>;
+	/// @brief		An argument template for `Flag`s.
+	using TemplateFlag = basic_arg_template<_internal::flag_t>;
+
+	/**
+	 * @struct	variant_template
+	 * @brief	An abstraction wrapper around `basic_arg_template` that accepts types `TemplateOption` & `TemplateFlag`
+	 */
+	class variant_template : public std::variant<TemplateFlag, TemplateOption> {
+	protected:
+		using base_t = std::variant<TemplateFlag, TemplateOption>;
+
+	public:
+		template<typename... Ts> requires std::constructible_from<base_t, Ts...> CONSTEXPR variant_template(Ts&&... args) : base_t(std::forward<Ts>(args)...) {}
+
+		/**
+		 * @brief
+		 * @tparam TVisitor
 		 * @param visitor		A function or lambda to use as the visitor when calling ``
 		 * @returns				The value returned by the visitor function.
 		 */
 		template<typename TVisitor>
 		CONSTEXPR auto visit(const TVisitor& visitor) const noexcept
 		{
-			return std::visit(visitor, static_cast<base_t>(*this));
+			return std::visit(visitor, static_cast<base_t const&>(*this));
 		}
 
 		CONSTEXPR std::optional<CaptureStyle> getCaptureStyle() const;
@@ -1535,6 +2019,7 @@ namespace opt3 {
 		 * @brief		Sets the minimum number of arguments from this group that must be specified.
 		 * @param min	Minimum argument count.
 		 *\n			If the user doesn't specify (any) argument from this group at least this many times, an exception is thrown by the parser.
+		 *\n			By default, this is only checked once any argument from this group appears; see ArgParsingRules::strictGroupCounts.
 		 * @returns		The reference of this instance.
 		 */
 		CONSTEXPR variant_template_group& SetMin(const size_t min) noexcept
@@ -1667,17 +2152,226 @@ namespace opt3 {
 	 */
 	template<typename T> concept valid_capture = var::any_same_or_convertible<T, variant_template, variant_template_group, vstring>;
 
+	namespace _internal {
+		/// @brief	The result of looking up an argument name in a capture list or schema.
+		struct capture_info {
+			static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+			/// @brief	Index of the group that contains the name, or npos when there isn't one.
+			size_t group{ npos };
+			/// @brief	The capture style of the name; this is CaptureStyle::Disabled when there isn't a group.
+			CaptureStyle captureStyle{ CaptureStyle::Disabled };
+
+			constexpr bool found() const noexcept { return group != npos; }
+		};
+
+		/**
+		 * @class		group_rules
+		 * @brief		The count limits of each group, and the conflicts between groups, stored in flat tables indexed by group.
+		 *\n			Conflicts are stored as one bit matrix per ConflictStyle, so a group is checked against every other group with a few word-sized ANDs.
+		 * @tparam G	The number of groups, or std::dynamic_extent when it's only known at runtime.
+		 */
+		template<size_t G>
+		class group_rules {
+			static constexpr bool is_dynamic{ G == std::dynamic_extent };
+			static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+			/// @returns	The number of 64-bit words in each row of a bit matrix with the given number of columns.
+			static constexpr size_t stride_of(size_t const& count) noexcept { return (count + 63ull) / 64ull; }
+
+			template<class T, size_t Size>
+			using table_t = std::conditional_t<is_dynamic, std::vector<T>, std::array<T, Size>>;
+			using counts_t = table_t<size_t, (is_dynamic ? 0ull : G)>;
+			using row_t = table_t<uint64_t, (is_dynamic ? 0ull : stride_of(G))>;
+			using matrix_t = table_t<uint64_t, (is_dynamic ? 0ull : G * stride_of(G))>;
+
+			/// @returns	A zero-filled table with the given number of elements.
+			template<class T>
+			static constexpr T make_table(size_t const& size)
+			{
+				if constexpr (is_dynamic)
+					return T(size);
+				else return T{};
+			}
+
+			/// @brief	The number of groups.
+			size_t groupCount;
+			/// @brief	The number of 64-bit words in each row of the conflict matrices.
+			size_t stride;
+			/// @brief	The (inclusive) maximum argument count of each group.
+			table_t<std::optional<size_t>, (is_dynamic ? 0ull : G)> max;
+			/// @brief	The (inclusive) minimum argument count of each group.
+			counts_t min;
+			/// @brief	Bit b of row a is set when group a conflicts with group b using ConflictStyle::Conflict.
+			matrix_t conflicts;
+			/// @brief	Bit b of row a is set when group a conflicts with group b using ConflictStyle::CapturesConflict.
+			matrix_t captureConflicts;
+
+		public:
+			/// @brief	Creates a group_rules instance with G groups that have no limits or conflicts.
+			constexpr group_rules() requires (!is_dynamic) : groupCount{ G }, stride{ stride_of(G) }, max{}, min{}, conflicts{}, captureConflicts{} {}
+			/// @brief	Creates a group_rules instance with the given number of groups that have no limits or conflicts.
+			explicit group_rules(size_t const& count = 0ull) requires is_dynamic :
+				groupCount{ count },
+				stride{ stride_of(count) },
+				max(count),
+				min(count),
+				conflicts(count * stride),
+				captureConflicts(count * stride)
+			{}
+
+			/// @returns	The number of groups.
+			constexpr size_t size() const noexcept { return groupCount; }
+
+			/// @brief	Sets the count limits of a group.
+			constexpr void set_limits(size_t const& group, size_t const& minCount, std::optional<size_t> const& maxCount) noexcept
+			{
+				min[group] = minCount;
+				max[group] = maxCount;
+			}
+			/// @brief	Adds a conflict between two groups. When a pair has more than one conflict, the strictest one wins.
+			constexpr void add_conflict(size_t const& group, size_t const& other, ConflictStyle const& style) noexcept
+			{
+				const auto& bit{ 1ull << (other % 64ull) };
+				switch (style) {
+				case ConflictStyle::CapturesConflict:
+					captureConflicts[group * stride + other / 64ull] |= bit;
+					break;
+				case ConflictStyle::Conflict:
+					conflicts[group * stride + other / 64ull] |= bit;
+					break;
+				default:break;
+				}
+			}
+
+			/**
+			 * @class	counter
+			 * @brief	Counts the arguments & captures of each group as they're parsed, using group ids that were resolved by the tokenizer.
+			 *\n		The maximum count is checked as arguments are added, but the error is only thrown by validate() so that parsing errors take precedence.
+			 */
+			class counter {
+				group_rules const& rules;
+				counts_t args;
+				counts_t captures;
+				/// @brief	The group of the first argument that exceeded its maximum count, or npos.
+				size_t overflow{ npos };
+				/// @brief	Whether the minimum count of a group is checked when none of its arguments appeared.
+				bool checkAbsentGroups;
+
+			public:
+				/**
+				 * @brief					Creates a new counter with every count set to 0.
+				 * @param rules				The rules of the groups to count.
+				 * @param checkAbsentGroups	When true, the minimum count of every group is checked; otherwise only groups that appeared at least once are checked.
+				 */
+				constexpr counter(group_rules const& rules, bool const checkAbsentGroups) :
+					rules{ rules },
+					args{ make_table<counts_t>(rules.size()) },
+					captures{ make_table<counts_t>(rules.size()) },
+					checkAbsentGroups{ checkAbsentGroups }
+				{}
+
+				/**
+				 * @brief				Counts an argument.
+				 * @param group			The group of the argument; npos is ignored, so Parameters & unknown arguments can be passed as-is.
+				 *\n					Groups that don't exist in the rules are ignored too, so a stale group index can't write out of bounds.
+				 * @param hasCapture	Whether the argument captured input.
+				 */
+				constexpr void add(size_t const& group, bool const& hasCapture) noexcept
+				{
+					if (group >= rules.size())
+						return;
+					if (hasCapture)
+						++captures[group];
+					if (++args[group] > rules.max[group].value_or(npos) && overflow == npos)
+						overflow = group;
+				}
+
+				/**
+				 * @brief				Validates the number of times each group appeared, and checks for conflicts between groups.
+				 * @param describe		A callable that takes a group index and returns something that prints the names of that group.
+				 * @throws ex::except	An argument appeared too many or too few times, or conflicting arguments were specified.
+				 */
+				template<std::invocable<size_t> TDescribe>
+				void validate(TDescribe const& describe) const
+				{
+					if (overflow != npos)
+						throw make_exception("Argument '", describe(overflow), "' was specified too many times! (Expected a maximum of ", rules.max[overflow].value(), ")");
+
+					// the groups that appeared & the groups that captured input, in the same layout as a row of the conflict matrices
+					auto present{ make_table<row_t>(rules.stride) }, captured{ make_table<row_t>(rules.stride) };
+					for (size_t g{ 0 }; g < rules.size(); ++g) {
+						if (args[g] > 0ull)
+							present[g / 64ull] |= 1ull << (g % 64ull);
+						if (captures[g] > 0ull)
+							captured[g / 64ull] |= 1ull << (g % 64ull);
+					}
+
+					for (size_t g{ 0 }; g < rules.size(); ++g) {
+						if (args[g] == 0ull && !checkAbsentGroups)
+							continue;
+						if (const auto& min{ rules.min[g] }; args[g] < min)
+							throw make_exception("Expected argument '", describe(g), "' at least ", min, " time", (min == 1 ? "" : "s"), '!');
+						if (args[g] == 0ull)
+							continue;
+
+						for (size_t w{ 0 }, row{ g * rules.stride }; w < rules.stride; ++w) {
+							const auto& conflict{ rules.conflicts[row + w] & present[w] };
+							const auto& captureConflict{ captures[g] > 0ull ? rules.captureConflicts[row + w] & captured[w] : 0ull };
+							if ((conflict | captureConflict) == 0ull)
+								continue;
+
+							const auto& bit{ std::countr_zero(conflict | captureConflict) };
+							const auto& other{ w * 64ull + static_cast<size_t>(bit) };
+							if ((conflict >> bit) & 1ull)
+								throw make_exception("Argument        ( ", describe(g), " )\n",
+													 indent(10), "conflicts with: ( ", describe(other), " )"
+								);
+							else throw make_exception("Only one of the following arguments can accept input at the same time: [\n",
+													  indent(14), describe(g), '\n',
+													  indent(14), describe(other), '\n',
+													  indent(10), ']');
+						}
+					}
+				}
+			};
+		};
+	}
+
 	/**
 	 * @struct	capture_list
 	 * @brief	A small wrapper object that inherits from a std::vector.
+	 *\n		Argument names are indexed when the list is constructed, so looking up the group or capture style of an argument doesn't search every template.
+	 *\n		Any non-const access to the list makes the index out-of-date, after which lookups search every template until reindex() is called.
+	 *\n		parse() & parse_view() accept an out-of-date list too, but have to index a copy of it each time; call reindex() once instead.
 	 *			TODO: Implement this properly instead of inheriting from std::vector.
 	 */
-	struct capture_list : std::vector<variant_template_group> {
-		using base_t = std::vector<variant_template_group>;
+	struct capture_list : _internal::tracked_vector<variant_template_group> {
+		using base_t = _internal::tracked_vector<variant_template_group>;
 		using iterator_t = std::vector<variant_template_group>::iterator;
 		using const_iterator_t = std::vector<variant_template_group>::const_iterator;
 
 	private:
+		/// @brief	The position of an argument template within the capture list.
+		struct index_entry {
+			static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+			/// @brief	Index of the group that contains the template, or npos when there isn't one.
+			size_t group{ npos };
+			/// @brief	Index of the template within its group.
+			size_t templ{ 0 };
+
+			CONSTEXPR bool found() const noexcept { return group != npos; }
+		};
+		/// @brief	Index of templates with multi-character names.
+		std::unordered_map<std::string, index_entry, _internal::string_hash, std::equal_to<>> names;
+		/// @brief	Index of templates with single-character names, indexed by character.
+		std::array<index_entry, 256> chars;
+		/// @brief	The modification count of the list when the index was built.
+		size_t indexedModificationCount{ 0 };
+		/// @brief	The count limits & conflicts of each group, resolved to group indexes when the index was built.
+		_internal::group_rules<std::dynamic_extent> rules;
+
 		template<size_t IDX, valid_capture... Ts>
 		static base_t& build(base_t& vec, std::tuple<Ts...>&& tpl)
 		{
@@ -1696,27 +2390,115 @@ namespace opt3 {
 			return vec;
 		}
 
+		/// @brief	Finds the first template with the given name, searching every group in order. This is used when the index is out of date.
+		index_entry scan(std::string_view const& name) const
+		{
+			for (size_t g{ 0 }; g < this->size(); ++g) {
+				const auto& templates{ (*this)[g].templates };
+				for (size_t t{ 0 }; t < templates.size(); ++t)
+					if (templates[t].name() == name)
+						return{ g, t };
+			}
+			return{};
+		}
+		/// @brief	Finds the first template with the given name.
+		index_entry find(std::string_view const& name) const
+		{
+			if (!is_indexed())
+				return scan(name);
+			if (name.size() == 1ull)
+				return chars[static_cast<uchar>(name.front())];
+			if (const auto& it{ names.find(name) }; it != names.end())
+				return it->second;
+			return{};
+		}
+		/// @brief	Finds the first template with the given single-character name.
+		index_entry find(char const& name) const
+		{
+			if (!is_indexed())
+				return scan(std::string_view{ &name, 1ull });
+			return chars[static_cast<uchar>(name)];
+		}
+		/// @brief	The group rules & the group indexes returned by an out-of-date index refer to different groups, so they can't be used to count arguments.
+		void throw_if_stale() const
+		{
+			if (!is_indexed())
+				throw make_exception("The capture list was modified after it was indexed; call reindex() before counting arguments.");
+		}
+		/// @brief	Gets the capture style of the template at the given position.
+		CaptureStyle capture_style_at(index_entry const& entry) const
+		{
+			if (!entry.found())
+				return CaptureStyle::Disabled;
+			const auto& group{ (*this)[entry.group] };
+			return group.templates[entry.templ].getCaptureStyle().value_or(group._defaultCaptureStyle);
+		}
+
 	public:
+		/// @brief	Counts the arguments of each group while parsing; see make_counter().
+		using counter_t = _internal::group_rules<std::dynamic_extent>::counter;
+
 		/**
 		 * @brief		Creates a new capture_list instance with no entries.
 		 */
-		STRCONSTEXPR capture_list() : base_t() {}
+		capture_list() : base_t() {}
 		/**
 		 * @brief			Creates a new capture_list instance with the given entries.
 		 * @param captures	Any number of valid argument names as strings or chars.
 		 */
 		template<valid_capture... Ts> requires var::more_than<0, Ts...>
-		STRCONSTEXPR capture_list(Ts&&... captures) : base_t(build(std::make_tuple(std::forward<Ts>(captures)...))) {}
+		capture_list(Ts&&... captures) : base_t(build(std::make_tuple(std::forward<Ts>(captures)...)))
+		{
+			reindex();
+		}
+
+		/**
+		 * @brief	Rebuilds the index of argument names. When more than one template has the same name, the first one takes precedence.
+		 *\n		Call this after modifying the list; until then, lookups search every template & arguments can't be counted.
+		 */
+		void reindex()
+		{
+			const auto& list{ std::as_const(*this) };
+			names.clear();
+			chars.fill(index_entry{});
+			for (size_t g{ 0 }; g < list.size(); ++g) {
+				const auto& templates{ list[g].templates };
+				for (size_t t{ 0 }; t < templates.size(); ++t) {
+					if (auto name{ templates[t].name() }; name.size() == 1ull) {
+						if (auto& entry{ chars[static_cast<uchar>(name.front())] }; !entry.found())
+							entry = { g, t };
+					}
+					else names.try_emplace(std::move(name), index_entry{ g, t });
+				}
+			}
+			indexedModificationCount = list.modification_count();
+
+			// resolve conflicts to group indexes once, instead of looking up every conflict name each time arguments are validated
+			rules = _internal::group_rules<std::dynamic_extent>{ list.size() };
+			for (size_t g{ 0 }; g < list.size(); ++g) {
+				const auto& group{ list[g] };
+				rules.set_limits(g, group._min, group._max);
+				for (const auto& conflict : group.conflicts)
+					if (const auto& entry{ find(conflict.name) }; entry.found())
+						rules.add_conflict(g, entry.group, conflict.style.value_or(group._defaultConflictStyle));
+			}
+		}
+
+		/**
+		 * @brief		Checks if the index is up-to-date.
+		 * @returns		true when the index was built and the list hasn't been accessed through a non-const member since; otherwise false.
+		 */
+		bool is_indexed() const noexcept { return indexedModificationCount == this->modification_count(); }
 
 		/**
 		 * @brief		Gets an iterator pointing to the capture group that contains an argument with the given name.
 		 * @param name	Input argument name.
 		 * @returns		An iterator pointing to the first capture group that contains the given argument name if one was found; otherwise an iterator pointing to the end position of the capture list.
 		 */
-		iterator_t get_group_of(vstring const& name)
+		iterator_t get_group_of(std::string_view const& name)
 		{
-			if (const auto& it{ std::find_if(this->begin(), this->end(), [&name](auto&& v) { return std::any_of(v.templates.begin(), v.templates.end(), [&name](auto&& vtemplate) { return vtemplate.name() == name; }); }) }; it != this->end())
-				return it;
+			if (const auto& entry{ find(name) }; entry.found())
+				return this->begin() + entry.group;
 			return this->end();
 		}
 		/**
@@ -1724,10 +2506,10 @@ namespace opt3 {
 		 * @param name	Input argument name.
 		 * @returns		An iterator pointing to the first capture group that contains the given argument name if one was found; otherwise an iterator pointing to the end position of the capture list.
 		 */
-		const_iterator_t get_group_of(vstring const& name) const
+		const_iterator_t get_group_of(std::string_view const& name) const
 		{
-			if (const auto& it{ std::find_if(this->begin(), this->end(), [&name](auto&& v) { return std::any_of(v.templates.begin(), v.templates.end(), [&name](auto&& vtemplate) { return vtemplate.name() == name; }); }) }; it != this->end())
-				return it;
+			if (const auto& entry{ find(name) }; entry.found())
+				return this->begin() + entry.group;
 			return this->end();
 		}
 
@@ -1759,11 +2541,18 @@ namespace opt3 {
 		 * @param name	Input argument name.
 		 * @returns		The CaptureStyle associated with the given argument name.
 		 */
-		CaptureStyle get_capture_style_of(vstring const& name) const
+		CaptureStyle get_capture_style_of(std::string_view const& name) const
+		{
+			return capture_style_at(find(name));
+		}
+		/**
+		 * @brief		Gets the CaptureStyle associated with a given flag.
+		 * @param name	Input flag name.
+		 * @returns		The CaptureStyle associated with the given flag name.
+		 */
+		CaptureStyle get_capture_style_of(char const& name) const
 		{
-			if (const auto& group{ get_group_of(name) }; group != this->end())
-				return group->get_capture_style_of(name);
-			return CaptureStyle::Disabled;
+			return capture_style_at(find(name));
 		}
 
 		/**
@@ -1771,16 +2560,494 @@ namespace opt3 {
 		 * @param name	The name of an Option/Flag to search for.
 		 * @returns		true when the given name is present somewhere in the capture list.
 		 */
-		bool is_present(vstring const& name) const
+		bool is_present(std::string_view const& name) const
+		{
+			return find(name).found();
+		}
+		/**
+		 * @brief		Checks if the given Flag name was specified in the capture list.
+		 * @param name	The name of a Flag to search for.
+		 * @returns		true when the given name is present somewhere in the capture list.
+		 */
+		bool is_present(char const& name) const
+		{
+			return find(name).found();
+		}
+
+		/**
+		 * @brief		Gets the group index & capture style of an argument with a single lookup.
+		 * @param name	Input argument name.
+		 * @returns		The position of the first group that contains the given name & its capture style; the group is capture_info::npos when the name isn't present.
+		 */
+		_internal::capture_info lookup(std::string_view const& name) const
+		{
+			const auto& entry{ find(name) };
+			return{ entry.group, capture_style_at(entry) };
+		}
+		/**
+		 * @brief		Gets the group index & capture style of a flag with a single lookup.
+		 * @param name	Input flag name.
+		 * @returns		The position of the first group that contains the given name & its capture style; the group is capture_info::npos when the name isn't present.
+		 */
+		_internal::capture_info lookup(char const& name) const
+		{
+			const auto& entry{ find(name) };
+			return{ entry.group, capture_style_at(entry) };
+		}
+
+		/**
+		 * @brief				Creates a counter for the groups in this list, which is given the group of each argument as it's parsed and then passed to validate().
+		 *\n					The list must outlive the counter.
+		 * @param strict		When true, every group is checked against its minimum count; otherwise only the groups that appeared are. See ArgParsingRules::strictGroupCounts.
+		 * @returns				A new counter_t instance with every count set to 0.
+		 * @throws ex::except	The list was modified since the index was built; call reindex() first.
+		 */
+		counter_t make_counter(bool const strict = false) const
+		{
+			throw_if_stale();
+			return counter_t{ rules, strict };
+		}
+		/**
+		 * @brief				Validates the number of times each group appeared, and checks for conflicts between groups.
+		 * @param counter		A counter created by make_counter() that every parsed argument was added to.
+		 * @throws ex::except	An argument appeared too many or too few times, or conflicting arguments were specified.
+		 *\n					Also thrown when the list was modified since the index was built.
+		 */
+		void validate(counter_t const& counter) const
 		{
-			return std::any_of(this->begin(), this->end(), [&name](variant_template_group const& vtGroup) {
-				return std::any_of(vtGroup.templates.begin(), vtGroup.templates.end(), [&name](variant_template const& vt) {
-								   return vt.name() == name;
-							   });
-							   });
+			throw_if_stale();
+			counter.validate([this](size_t const& g) -> variant_template_group const& { return (*this)[g]; });
 		}
 	};
 
+#pragma region schema
+	/**
+	 * @struct	schema_conflict
+	 * @brief	The compile-time counterpart of arg_conflict; the name of a conflicting argument with an optional `ConflictStyle`.
+	 */
+	struct schema_conflict {
+		/// @brief	The name of the conflicting argument.
+		std::string_view name;
+		/// @brief	Optional conflict style override for this conflict only.
+		std::optional<ConflictStyle> style{ std::nullopt };
+
+		constexpr schema_conflict() = default;
+		/**
+		 * @brief					Creates a new schema_conflict instance.
+		 * @param name				The name of the conflicting argument.
+		 */
+		constexpr schema_conflict(std::string_view const& name) : name{ name } {}
+		/**
+		 * @brief					Creates a new schema_conflict instance.
+		 * @param name				The name of the conflicting argument.
+		 * @param conflictStyle		A conflict style that overrides the group's default for this conflict only.
+		 */
+		constexpr schema_conflict(std::string_view const& name, ConflictStyle const& conflictStyle) : name{ name }, style{ conflictStyle } {}
+	};
+
+	/**
+	 * @struct		schema_group
+	 * @brief		The compile-time counterpart of variant_template_group, for use with `schema`.
+	 *\n			Names that are a single character are flags, and all other names are options.
+	 *\n			The setters return a modified copy instead of modifying the instance, so they can be chained in constant expressions.
+	 * @tparam N	The number of argument names in the group.
+	 * @tparam C	The number of conflicts defined by the group.
+	 */
+	template<size_t N, size_t C = 0ull>
+	struct schema_group {
+		/// @brief	Argument names defined by this group, excluding prefixes.
+		std::array<std::string_view, N> names{};
+		/// @brief	Capture style of the arguments in this group.
+		CaptureStyle _defaultCaptureStyle{ CaptureStyle::Optional };
+		/// @brief	Default conflict style for conflict definitions that don't override it.
+		ConflictStyle _defaultConflictStyle{ ConflictStyle::Conflict };
+		/// @brief	An optional *(inclusive)* maximum argument count.
+		std::optional<size_t> _max{ std::nullopt };
+		/// @brief	An *(inclusive)* minimum argument count.
+		size_t _min{ 0ull };
+		/// @brief	Conflicting argument definitions for this group.
+		std::array<schema_conflict, C> conflicts{};
+
+		constexpr schema_group() = default;
+		/**
+		 * @brief		Creates a new schema_group instance with the given argument names.
+		 * @param args	The names of the arguments in the group, excluding prefixes.
+		 */
+		template<std::convertible_to<std::string_view>... Ts> requires (sizeof...(Ts) == N && N > 0ull)
+		constexpr schema_group(Ts const&... args) : names{ std::string_view{ args }... } {}
+
+		/// @brief	Returns a copy of this group with the specified capture style.
+		constexpr schema_group SetCaptureStyle(const CaptureStyle& cs) const noexcept
+		{
+			auto copy{ *this };
+			copy._defaultCaptureStyle = cs;
+			return copy;
+		}
+		/// @brief	Returns a copy of this group with the specified default conflict style.
+		constexpr schema_group SetConflictStyle(const ConflictStyle& cs) const noexcept
+		{
+			auto copy{ *this };
+			copy._defaultConflictStyle = cs;
+			return copy;
+		}
+		/// @brief	Returns a copy of this group with the specified minimum argument count.
+		constexpr schema_group SetMin(const size_t min) const noexcept
+		{
+			auto copy{ *this };
+			copy._min = min;
+			return copy;
+		}
+		/// @brief	Returns a copy of this group with the specified maximum argument count.
+		constexpr schema_group SetMax(const std::optional<size_t>& max) const noexcept
+		{
+			auto copy{ *this };
+			copy._max = max;
+			return copy;
+		}
+		/**
+		 * @brief		Returns a copy of this group with additional conflicts.
+		 * @param args	Any number of argument names or schema_conflict definitions.
+		 */
+		template<typename... Ts> requires (std::constructible_from<schema_conflict, Ts> && ...)
+		constexpr schema_group<N, C + sizeof...(Ts)> SetConflicts(Ts const&... args) const
+		{
+			schema_group<N, C + sizeof...(Ts)> copy;
+			copy.names = names;
+			copy._defaultCaptureStyle = _defaultCaptureStyle;
+			copy._defaultConflictStyle = _defaultConflictStyle;
+			copy._max = _max;
+			copy._min = _min;
+			std::ranges::copy(conflicts, copy.conflicts.begin());
+			size_t i{ C };
+			((copy.conflicts[i++] = schema_conflict{ args }), ...);
+			return copy;
+		}
+	};
+	template<std::convertible_to<std::string_view>... Ts>
+	schema_group(Ts const&...) -> schema_group<sizeof...(Ts)>;
+
+	namespace _internal {
+		/// @brief	Seeded FNV-1a hash that is used to build the perfect hash table in `schema`.
+		constexpr uint64_t schema_hash(std::string_view const& name, uint64_t const& seed) noexcept
+		{
+			uint64_t hash{ 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull) };
+			for (const auto& c : name) {
+				hash ^= static_cast<uchar>(c);
+				hash *= 1099511628211ull;
+			}
+			return hash ^ (hash >> 29);
+		}
+
+		/// @brief	Checks if the given argument is a Parameter.
+		inline bool is_parameter(variantarg const& arg) noexcept { return arg.is_type<Parameter>(); }
+		/// @brief	Checks if the given argument is a ParameterView.
+		inline bool is_parameter(variantarg_view const& arg) noexcept { return arg.is_type<ParameterView>(); }
+	}
+
+	/**
+	 * @class		schema
+	 * @brief		A capture list that is built & checked at compile time, which can be used in place of `capture_list` with parse() & parse_view().
+	 *\n			Single-character names are looked up in a 256-entry table, and all other names in a perfect hash table, so classifying an argument never searches.
+	 *\n			Counts & conflicts are validated with flat tables indexed by group; conflicts between groups are resolved when the schema is built.
+	 *\n			Mistakes in the definition, such as duplicate names or conflicts with names that don't exist, are compile errors.
+	 * @tparam G	The number of groups in the schema.
+	 * @tparam N	The total number of argument names in the schema.
+	 */
+	template<size_t G, size_t N>
+	class schema {
+	public:
+		/// @brief	Returned by get_group_of() when a name isn't in the schema.
+		static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+	private:
+		/// @brief	The number of buckets in the perfect hash table; each bucket has its own seed.
+		static constexpr size_t bucket_count{ N == 0ull ? 1ull : N };
+		/// @brief	The number of slots in the perfect hash table.
+		static constexpr size_t table_size{ std::bit_ceil(bucket_count * 2ull) };
+
+		struct name_entry {
+			std::string_view name;
+			size_t group{ npos };
+		};
+		struct group_entry {
+			CaptureStyle captureStyle{ CaptureStyle::Optional };
+			/// @brief	The position of the group's first name in names.
+			size_t first{ 0ull };
+			/// @brief	The number of names in the group.
+			size_t count{ 0ull };
+		};
+
+		/// @brief	Every argument name, ordered by group.
+		std::array<name_entry, N> names{};
+		/// @brief	The capture style & names of each group.
+		std::array<group_entry, G> groups{};
+		/// @brief	The count limits of each group & the conflicts between groups.
+		_internal::group_rules<G> rules{};
+		/// @brief	The position in names of each single-character name, indexed by character.
+		std::array<size_t, 256> chars{};
+		/// @brief	The seed of each bucket in the perfect hash table.
+		std::array<uint64_t, bucket_count> seeds{};
+		/// @brief	The perfect hash table of multi-character names, which contains positions in names.
+		std::array<size_t, table_size> table{};
+
+		/// @returns	The bucket that the given multi-character name belongs to.
+		static constexpr size_t bucket_of(std::string_view const& name) noexcept { return static_cast<size_t>(_internal::schema_hash(name, 0ull) % bucket_count); }
+		/// @returns	The slot in the perfect hash table of the given multi-character name, when its bucket uses the given seed.
+		static constexpr size_t slot_of(std::string_view const& name, uint64_t const& seed) noexcept { return static_cast<size_t>(_internal::schema_hash(name, seed) & (table_size - 1ull)); }
+
+		/// @returns	The position of the given name in names, or npos if it isn't in the schema.
+		constexpr size_t find(std::string_view const& name) const noexcept
+		{
+			if (name.size() == 1ull)
+				return chars[static_cast<uchar>(name.front())];
+			if (name.empty())
+				return npos;
+			if (const auto& i{ table[slot_of(name, seeds[bucket_of(name)])] }; i != npos && names[i].name == name)
+				return i;
+			return npos;
+		}
+		/// @returns	The position of the given single-character name in names, or npos if it isn't in the schema.
+		constexpr size_t find(char const& name) const noexcept
+		{
+			return chars[static_cast<uchar>(name)];
+		}
+
+		/// @brief	Builds the perfect hash table by giving each bucket a seed that moves all of its names into empty slots, starting with the largest buckets.
+		CONSTEVAL void build_table()
+		{
+			std::array<size_t, bucket_count> sizes{}, order{};
+			for (const auto& [name, group] : names)
+				if (name.size() > 1ull)
+					++sizes[bucket_of(name)];
+			for (size_t b{ 0 }; b < bucket_count; ++b)
+				order[b] = b;
+			std::ranges::sort(order, [&sizes](auto&& l, auto&& r) { return sizes[l] > sizes[r]; });
+
+			for (const auto& b : order) {
+				if (sizes[b] == 0ull)
+					break;
+				for (uint64_t seed{ 1ull }; ; ++seed) {
+					if (seed > 0xFFFFull)
+						throw make_exception("opt3::schema:  Failed to build a perfect hash table for the argument names!");
+					std::array<size_t, N> slots{};
+					size_t count{ 0 };
+					for (size_t i{ 0 }; i < N && count != npos; ++i) {
+						if (names[i].name.size() == 1ull || bucket_of(names[i].name) != b)
+							continue;
+						const auto& slot{ slot_of(names[i].name, seed) };
+						if (table[slot] != npos || std::ranges::find(slots.begin(), slots.begin() + count, slot) != slots.begin() + count)
+							count = npos;
+						else slots[count++] = slot;
+					}
+					if (count == npos)
+						continue;
+					for (size_t i{ 0 }, j{ 0 }; i < N; ++i)
+						if (names[i].name.size() > 1ull && bucket_of(names[i].name) == b)
+							table[slots[j++]] = i;
+					seeds[b] = seed;
+					break;
+				}
+			}
+		}
+
+		/// @brief	Prints the names of a group in the same format as variant_template_group.
+		struct group_printer {
+			schema const& s;
+			size_t group;
+
+			std::ostream& print(std::ostream& os) const
+			{
+				const auto& g{ s.groups[group] };
+				for (size_t i{ g.first }; i < g.first + g.count; ++i) {
+					if (i != g.first)
+						os << " | ";
+					os << (s.names[i].name.size() == 1ull ? "-" : "--") << s.names[i].name;
+				}
+				return os;
+			}
+			friend std::ostream& operator<<(std::ostream& os, group_printer const& p) { return p.print(os); }
+		};
+
+	public:
+		/**
+		 * @brief			Builds a schema from the given groups at compile time.
+		 * @param args		Any number of schema_group definitions. Each group's position is its id.
+		 */
+		template<size_t... Ns, size_t... Cs> requires (sizeof...(Ns) == G && (Ns + ... + 0ull) == N)
+		CONSTEVAL schema(schema_group<Ns, Cs> const&... args)
+		{
+			chars.fill(npos);
+			table.fill(npos);
+
+			size_t g{ 0 }, n{ 0 };
+			const auto& add_group{ [&](auto const& group) {
+				if (group._max.has_value() && group._min > group._max.value())
+					throw make_exception("opt3::schema:  A group's minimum argument count is greater than its maximum!");
+				groups[g] = group_entry{ group._defaultCaptureStyle, n, group.names.size() };
+				rules.set_limits(g, group._min, group._max);
+				for (const auto& name : group.names) {
+					if (name.empty())
+						throw make_exception("opt3::schema:  Argument names cannot be empty!");
+					if (name.find('=') != std::string_view::npos)
+						throw make_exception("opt3::schema:  Argument names cannot contain '='!");
+					for (size_t i{ 0 }; i < n; ++i)
+						if (names[i].name == name)
+							throw make_exception("opt3::schema:  Argument names must be unique!");
+					if (name.size() == 1ull)
+						chars[static_cast<uchar>(name.front())] = n;
+					names[n++] = name_entry{ name, g };
+				}
+				++g;
+			} };
+			(add_group(args), ...);
+
+			build_table();
+
+			g = 0;
+			const auto& add_conflicts{ [&](auto const& group) {
+				for (const auto& conflict : group.conflicts) {
+					const auto& i{ find(conflict.name) };
+					if (i == npos)
+						throw make_exception("opt3::schema:  A conflict refers to an argument name that isn't in the schema!");
+					rules.add_conflict(g, names[i].group, conflict.style.value_or(group._defaultConflictStyle));
+				}
+				++g;
+			} };
+			(add_conflicts(args), ...);
+		}
+
+		/**
+		 * @brief		Gets the id of the group that contains an argument with the given name.
+		 * @param name	Input argument name.
+		 * @returns		The position of the group in the schema if the name was found; otherwise npos.
+		 */
+		constexpr size_t get_group_of(std::string_view const& name) const noexcept
+		{
+			const auto& i{ find(name) };
+			return i == npos ? npos : names[i].group;
+		}
+		/**
+		 * @brief		Gets the id of the group that contains a flag with the given name.
+		 * @param name	Input flag name.
+		 * @returns		The position of the group in the schema if the name was found; otherwise npos.
+		 */
+		constexpr size_t get_group_of(char const& name) const noexcept
+		{
+			const auto& i{ find(name) };
+			return i == npos ? npos : names[i].group;
+		}
+		/**
+		 * @brief		Gets the CaptureStyle associated with a given argument.
+		 * @param name	Input argument name.
+		 * @returns		The CaptureStyle associated with the given argument name, or CaptureStyle::Disabled when it isn't in the schema.
+		 */
+		constexpr CaptureStyle get_capture_style_of(std::string_view const& name) const noexcept
+		{
+			const auto& g{ get_group_of(name) };
+			return g == npos ? CaptureStyle::Disabled : groups[g].captureStyle;
+		}
+		/**
+		 * @brief		Gets the CaptureStyle associated with a given flag.
+		 * @param name	Input flag name.
+		 * @returns		The CaptureStyle associated with the given flag name, or CaptureStyle::Disabled when it isn't in the schema.
+		 */
+		constexpr CaptureStyle get_capture_style_of(char const& name) const noexcept
+		{
+			const auto& g{ get_group_of(name) };
+			return g == npos ? CaptureStyle::Disabled : groups[g].captureStyle;
+		}
+		/**
+		 * @brief		Checks if the given Option/Flag name was specified in the schema.
+		 * @param name	The name of an Option/Flag to search for.
+		 * @returns		true when the given name is present in the schema.
+		 */
+		constexpr bool is_present(std::string_view const& name) const noexcept { return find(name) != npos; }
+		/**
+		 * @brief		Checks if the given Flag name was specified in the schema.
+		 * @param name	The name of a Flag to search for.
+		 * @returns		true when the given name is present in the schema.
+		 */
+		constexpr bool is_present(char const& name) const noexcept { return find(name) != npos; }
+
+		/**
+		 * @brief		Gets the group index & capture style of an argument with a single lookup.
+		 * @param name	Input argument name.
+		 * @returns		The position of the group that contains the given name & its capture style; the group is capture_info::npos when the name isn't in the schema.
+		 */
+		constexpr _internal::capture_info lookup(std::string_view const& name) const noexcept
+		{
+			const auto& g{ get_group_of(name) };
+			return{ g, g == npos ? CaptureStyle::Disabled : groups[g].captureStyle };
+		}
+		/**
+		 * @brief		Gets the group index & capture style of a flag with a single lookup.
+		 * @param name	Input flag name.
+		 * @returns		The position of the group that contains the given name & its capture style; the group is capture_info::npos when the name isn't in the schema.
+		 */
+		constexpr _internal::capture_info lookup(char const& name) const noexcept
+		{
+			const auto& g{ get_group_of(name) };
+			return{ g, g == npos ? CaptureStyle::Disabled : groups[g].captureStyle };
+		}
+
+		/// @brief	Counts the arguments of each group while parsing; see make_counter().
+		using counter_t = typename _internal::group_rules<G>::counter;
+
+		/**
+		 * @brief		Creates a counter for the groups in this schema, which is given the group of each argument as it's parsed and then passed to validate().
+		 *\n			The schema must outlive the counter. Every group is checked against its minimum count, whether or not it appeared.
+		 * @returns		A new counter_t instance with every count set to 0.
+		 */
+		constexpr counter_t make_counter() const { return counter_t{ rules, true }; }
+		/**
+		 * @brief				Validates the number of times each group appeared, and checks for conflicts between groups.
+		 * @param counter		A counter created by make_counter() that every parsed argument was added to.
+		 * @throws ex::except	An argument appeared too many or too few times, or conflicting arguments were specified.
+		 */
+		void validate(counter_t const& counter) const
+		{
+			counter.validate([this](size_t const& g) { return group_printer{ *this, g }; });
+		}
+		/**
+		 * @brief				Validates the number of times each group appears in already-parsed arguments, and checks for conflicts between groups.
+		 *\n					Only Flags & Options are counted; Parameters never belong to a group.
+		 * @param cont			The parsed arguments.
+		 * @throws ex::except	An argument appeared too many or too few times, or conflicting arguments were specified.
+		 */
+		template<class TContainer>
+		void validate(TContainer const& cont) const
+		{
+			auto counter{ make_counter() };
+			for (const auto& arg : cont)
+				if (!_internal::is_parameter(arg))
+					counter.add(get_group_of(arg.name()), arg.has_capture());
+			validate(counter);
+		}
+	};
+	template<size_t... Ns, size_t... Cs>
+	schema(schema_group<Ns, Cs> const&...) -> schema<sizeof...(Ns), (Ns + ... + 0ull)>;
+
+	/**
+	 * @brief			Builds a schema from the given groups at compile time.
+	 * @param groups	Any number of schema_group definitions. Each group's position is its id.
+	 * @returns			A new schema instance.
+	 */
+	template<size_t... Ns, size_t... Cs>
+	CONSTEVAL schema<sizeof...(Ns), (Ns + ... + 0ull)> make_schema(schema_group<Ns, Cs> const&... groups)
+	{
+		return schema<sizeof...(Ns), (Ns + ... + 0ull)>{ groups... };
+	}
+
+	/**
+	 * @concept		capture_lookup
+	 * @brief		Constraint that allows types that the parser can use to look up argument names, such as `capture_list` & `schema`.
+	 */
+	template<typename T> concept capture_lookup = requires(T const& captures, std::string_view const& name, char const& flag) {
+		{ captures.lookup(name) } -> std::convertible_to<_internal::capture_info>;
+		{ captures.lookup(flag) } -> std::convertible_to<_internal::capture_info>;
+	};
+#pragma endregion schema
+
 	/**
 	 * @struct	ArgParsingRules
 	 * @brief	Allows configuration of the rules used when parsing arguments.
@@ -1812,6 +3079,14 @@ namespace opt3 {
 		 * @brief	Whether to include the end of args specifier (2x delimiter chars ONLY; ex: '--') as a parameter in the arguments list.
 		 */
 		bool includeEndOfArgsSpecifierInOutput{ false };
+		/**
+		 * @brief	Determines how the arguments of each capture_list group are counted & validated.
+		 *\n		When false, only groups that appeared are checked against their minimum count (so that "--help" alone doesn't fail because another group is required),
+		 *\n		 and Parameters are counted toward the group that shares their name.
+		 *\n		When true, every group is checked against its minimum count, and Parameters are never counted; this is how schemas are always validated.
+		 *\n		Default: false
+		 */
+		bool strictGroupCounts{ false };
 
 		/**
 		 * @brief	Default Constructor.
@@ -1885,212 +3160,330 @@ namespace opt3 {
 	invalid_argument_exception(std::string const& argument_name, std::string const& argument_typename) : ex::except(str::stringify("Argument '", argument_name, "' is not a recognized ", argument_typename, '.')), argument_name{ argument_name } {}
 	);
 
-	/**
-	 * @brief				Parse commandline arguments into an ArgContainer instance.
-	 * @details				### Argument Types
-	 *						- Parameters are any arguments that do not begin with a dash '-' character that were not captured by another argument type.
-	 *						- Options are arguments that begin with 2 dash '-' characters, and can capture additional arguments if the option name appears in the capture list.
-	 *						- Flags are arguments that begin with a single dash '-' character, are a single character in length, and can capture additional arguments. Flags can appear alone, or in "chains" where each character is treated as an individual flag. In a flag chain, only the last flag can capture additional arguments.
-	 *						### Capture Rules
-	 *						- Only options/flags specified in the capture list are allowed to capture additional arguments. Capture list entries should not include a delimiter prefix.
-	 *						- Options/Flags cannot be captured under any circumstance. ex: "--opt --opt captured" results in "--opt", & "--opt" + "captured".
-	 *						- If a flag in a chain should capture an argument (either with an '=' delimiter or by context), it must appear at the end of the chain.
-	 *						- Any captured arguments do not appear in the argument list by themselves, and must be accessed through the argument that captured them.
-	 * @param args			Commandline arguments as a vector of strings, in order and including argv[0].
-	 * @param captures		A `capture_list` instance specifying which arguments are allowed to capture other arguments as their parameters
-	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
-	 * @returns				ArgContainer
-	 */
-	inline arg_container parse(std::vector<std::string>&& args, capture_list captures, const ArgParsingRules& parsingRules)
-	{
-		using namespace _internal;
+	namespace _internal {
+		/**
+		 * @brief				Splits commandline arguments into Parameters, Flags & Options without copying them. This is shared by parse() & parse_view().
+		 * @param args			A random-access range of arguments that are convertible to std::string_view. Empty arguments are skipped.
+		 * @param captures		The capture list or schema to use. A capture list's index should be up to date.
+		 * @param parsingRules	The parser configuration.
+		 * @param emit			A callable that is given each argument as a variantarg_view rvalue, in order, along with the index of its group.
+		 *\n					The group is resolved by the same lookup that determines how the argument captures; it's capture_info::npos for Parameters & unknown arguments.
+		 */
+		template<std::ranges::random_access_range TArgs, capture_lookup TCaptures, std::invocable<variantarg_view&&, size_t> TEmit>
+		inline void tokenize(TArgs const& args, TCaptures const& captures, const ArgParsingRules& parsingRules, TEmit&& emit)
+		{
+			const size_t count{ static_cast<size_t>(std::ranges::size(args)) };
+			const auto& at{ [&args](size_t const& i) -> std::string_view { return std::string_view{ args[i] }; } };
+			// gets the index of the next non-empty argument after i, or count if there isn't one
+			const auto& next{ [&](size_t i) {
+				while (++i < count && at(i).empty()) {}
+				return i;
+			} };
+			// checks if the argument at i is followed by an argument that it can capture
+			const auto& canCaptureNext{ [&](size_t const& i) {
+				const auto& n{ next(i) };
+				return n < count && !parsingRules.isDelimiter(at(n).front());
+			} };
+
+			// true when double-delimiter reached ("--")
+			bool endOfArgsReached{ false };
+
+			for (size_t i{ 0 }; i < count; ++i) {
+				const std::string_view current{ at(i) };
+				if (current.empty())
+					continue; //< empty arguments are possible when passing arguments from automated testing applications
+
+				if (endOfArgsReached || current.size() < 2ull || !parsingRules.isDelimiter(current.front())) {
+					// is parameter
+					emit(ParameterView{ current }, capture_info::npos);
+					continue;
+				}
 
-		// remove empty arguments, which are possible when passing arguments from automated testing applications
-		args.erase(std::remove_if(args.begin(), args.end(), [](auto&& s) { return s.empty(); }), args.end());
+				std::string_view arg{ current.substr(1ull) };
+				if (parsingRules.isDelimiter(arg.front())) {
+					// is option
+					arg.remove_prefix(1ull);
 
-		arg_container cont{};
-		cont.reserve(args.size());
+					if (arg.empty()) {
+						// is end of args specifier ("--" by default)
+						endOfArgsReached = true;
+						if (parsingRules.includeEndOfArgsSpecifierInOutput)
+							emit(ParameterView{ current }, capture_info::npos);
+						continue;
+					}
 
-		// true when double-delimiter reached ("--")
-		bool endOfArgsReached{ false };
-
-		for (std::vector<std::string>::const_iterator it{ args.begin() }; it != args.end(); ++it) {
-			std::string arg{ *it };
-			if (!endOfArgsReached) {
-				// check for capture args
-				if (arg.size() > 1 && parsingRules.isDelimiter(arg.at(0))) {
-					// is flag or option
-					arg = arg.substr(1);
-
-					if (parsingRules.isDelimiter(arg.at(0))) {
-						// is option
-						arg = arg.substr(1);
-
-						if (arg.empty()) {
-							// is end of args specifier ("--" by default)
-							endOfArgsReached = true;
-							if (parsingRules.includeEndOfArgsSpecifierInOutput) {
-								arg = *it;
-								goto JUMP_TO_PARAMETER;
-							}
-							else continue; //< don't add this to the args list
-						}
+					const auto eqPos{ arg.find('=') };
+					// split the capture from the option name when the argument contains an equals sign
+					const auto opt{ arg.substr(0ull, eqPos) };
 
-						if (const auto eqPos{ arg.find('=') }; eqPos != std::string::npos) {// argument contains an equals sign, split string
-							auto opt{ arg.substr(0ull, eqPos) }, cap{ arg.substr(eqPos + 1ull) };
-
-							if (!parsingRules.allowUnexpectedCaptureArgs && !captures.is_present(opt)) {
-								if (parsingRules.convertUnexpectedCaptureArgsToParameters)
-									cont.emplace_back(Parameter{ *it });
-								else throw make_custom_exception_explicit<invalid_argument_exception>(*it, "option");
-							}
-							else if (const auto& captureStyle{ captures.get_capture_style_of(opt) }; !CaptureIsDisabled(captureStyle))
-								cont.emplace_back(Option{ std::make_pair(std::move(opt), std::move(cap)) });
-							else {
-								if (CaptureIsRequired(captureStyle))
-									throw make_exception("Expected a capture argument for option '", opt, "'!");
-								cont.emplace_back(Option{ std::make_pair(std::move(opt), std::nullopt) });
-								if (!cap.empty()) {
-									arg = cap;
-									goto JUMP_TO_PARAMETER; // skip flag case, add invalid capture as a parameter
-								}
-							}
-						}
+					const auto& [group, captureStyle] { captures.lookup(opt) };
+					if (!parsingRules.allowUnexpectedCaptureArgs && group == capture_info::npos) {
+						if (parsingRules.convertUnexpectedCaptureArgsToParameters)
+							emit(ParameterView{ current }, capture_info::npos);
+						else throw make_custom_exception_explicit<invalid_argument_exception>(std::string{ current }, "option");
+					}
+					else if (eqPos != std::string_view::npos) {
+						const auto cap{ arg.substr(eqPos + 1ull) };
+						if (!CaptureIsDisabled(captureStyle))
+							emit(OptionView{ std::make_pair(opt, std::optional<std::string_view>{ cap }) }, group);
 						else {
-							if (!parsingRules.allowUnexpectedCaptureArgs && !captures.is_present(arg)) {
-								if (parsingRules.convertUnexpectedCaptureArgsToParameters)
-									cont.emplace_back(Parameter{ *it });
-								else throw make_custom_exception_explicit<invalid_argument_exception>(*it, "option");
-							}
-							else if (const auto& captureStyle{ captures.get_capture_style_of(arg) }; !CaptureIsDisabledOrEqualsOnly(captureStyle) && parsingRules.canCaptureNext(it, args.end())) // argument can capture next arg
-								cont.emplace_back(Option{ std::make_pair(arg, *++it) });
-							else {
-								if (CaptureIsRequired(captureStyle))
-									throw make_exception("Expected a capture argument for option '", arg, "'!");
-								cont.emplace_back(Option{ std::make_pair(arg, std::nullopt) });
-							}
+							emit(OptionView{ std::make_pair(opt, std::optional<std::string_view>{ std::nullopt }) }, group);
+							if (!cap.empty()) // add the invalid capture as a parameter
+								emit(ParameterView{ cap }, capture_info::npos);
 						}
 					}
+					else if (!CaptureIsDisabledOrEqualsOnly(captureStyle) && canCaptureNext(i)) // argument can capture next arg
+						emit(OptionView{ std::make_pair(opt, std::optional<std::string_view>{ at(i = next(i)) }) }, group);
 					else {
-						// is flag
-						std::optional<Flag> capt{ std::nullopt }; // this can contain a flag if there is a capturing flag at the end of a chain
-						std::string invCap{}; //< for invalid captures that should be treated as parameters
-
-						if (const auto eqPos{ arg.find('=') }; eqPos != std::string::npos) {
-							invCap = arg.substr(eqPos + 1ull); // get string following '=', use invCap in case flag can't capture
-							if (const auto flag{ arg.substr(eqPos - 1ull, 1ull) }; !CaptureIsDisabled(captures.get_capture_style_of(flag))) {
-								capt = Flag{ std::make_pair(flag.front(), invCap) }; // push the capturing flag to capt, insert into vector once all other flags in this chain are parsed
-								arg = arg.substr(0ull, eqPos - 1ull); // remove last flag, '=', and captured string from arg
-								invCap.clear(); // flag can capture, clear invCap
-							}
-							else
-								arg = arg.substr(0ull, eqPos); // remove everything from eqPos to arg.end()
-						}
+						if (CaptureIsRequired(captureStyle))
+							throw make_exception("Expected a capture argument for option '", opt, "'!");
+						emit(OptionView{ std::make_pair(opt, std::optional<std::string_view>{ std::nullopt }) }, group);
+					}
+					continue;
+				}
 
-						// iterate through characters in arg
-						bool convertToParameter{ false };
-						std::vector<Flag> flagsBuffer;
-						flagsBuffer.reserve(arg.size());
-						for (auto fl{ arg.begin() }; fl != arg.end(); ++fl) {
-							if (!parsingRules.allowUnexpectedCaptureArgs && !captures.is_present(*fl)) {
-								if (parsingRules.convertUnexpectedCaptureArgsToParameters) {
-									convertToParameter = true;
-									continue;
-								}
-								else throw make_custom_exception_explicit<invalid_argument_exception>(std::string{ 1ull, *fl }, "flag");
-							}
-
-							const auto& captureStyle{ captures.get_capture_style_of(std::string(1ull, *fl)) };
-							// If this is the last char, and it can capture
-							if (fl == arg.end() - 1ll && !CaptureIsDisabledOrEqualsOnly(captureStyle) && parsingRules.canCaptureNext(it, args.end()))
-								flagsBuffer.emplace_back(Flag{ std::make_pair(*fl, *++it) });
-							else {// not last char, or can't capture
-								if (CaptureIsRequired(captureStyle))
-									throw make_exception("Expected a capture argument for flag '", *fl, "'!");
-								flagsBuffer.emplace_back(Flag{ std::make_pair(*fl, std::nullopt) });
-							}
-						}
-						if (convertToParameter)
-							cont.emplace_back(Parameter{ *it });
-						else {
-							for (auto&& flag : flagsBuffer) {
-								cont.emplace_back(std::move(flag));
-							}
-						}
-						if (capt.has_value()) // flag captures are always at the end, but parsing them first puts them out of chronological order.
-							cont.emplace_back(std::move(capt.value()));
-						if (invCap.empty())
-							continue;
-						else arg = invCap; // set argument to invalid capture and fallthrough to add it as a parameter
-						goto JUMP_TO_PARAMETER;
+				// is flag
+				std::optional<FlagView> capt{ std::nullopt }; // this can contain a flag if there is a capturing flag at the end of a chain
+				size_t captGroup{ capture_info::npos };
+				std::string_view invCap{}; //< for invalid captures that should be treated as parameters
+
+				if (const auto eqPos{ arg.find('=') }; eqPos != std::string_view::npos) {
+					invCap = arg.substr(eqPos + 1ull); // get string following '=', use invCap in case flag can't capture
+					if (const auto& info{ eqPos > 0ull ? captures.lookup(arg[eqPos - 1ull]) : capture_info{} }; !CaptureIsDisabled(info.captureStyle)) {
+						capt = FlagView{ std::make_pair(arg[eqPos - 1ull], std::optional<std::string_view>{ invCap }) }; // insert the capturing flag once all other flags in this chain are parsed
+						captGroup = info.group;
+						arg = arg.substr(0ull, eqPos - 1ull); // remove last flag, '=', and captured string from arg
+						invCap = {}; // flag can capture, clear invCap
 					}
+					else arg = arg.substr(0ull, eqPos); // remove everything from eqPos to arg.end()
 				}
-				// else is parameter
-				else goto JUMP_TO_PARAMETER;
-			}
-			else {
-			JUMP_TO_PARAMETER:
-				cont.emplace_back(arg);
-			}
-		}
-		cont.shrink_to_fit();
 
-		// count each argument
-		std::map<capture_list::iterator_t, std::pair<size_t, size_t>> counts;
-		for (const auto& varg : cont) {
-			if (auto groupOf{ captures.get_group_of(varg.name()) }; groupOf != captures.end()) {
-				auto& g{ counts[groupOf] };
+				// validate each flag in the chain before adding any of them
+				bool convertToParameter{ false }, captureNext{ false };
+				for (size_t fl{ 0 }; fl < arg.size(); ++fl) {
+					const auto& [group, captureStyle] { captures.lookup(arg[fl]) };
+					if (!parsingRules.allowUnexpectedCaptureArgs && group == capture_info::npos) {
+						if (parsingRules.convertUnexpectedCaptureArgsToParameters) {
+							convertToParameter = true;
+							continue;
+						}
+						else throw make_custom_exception_explicit<invalid_argument_exception>(std::string(1ull, arg[fl]), "flag");
+					}
 
-				++g.first; //< increment arg counter
-				if (varg.has_capture())
-					++g.second; //< increment capture counter
+					// If this is the last char, and it can capture
+					if (fl + 1ull == arg.size() && !CaptureIsDisabledOrEqualsOnly(captureStyle) && canCaptureNext(i))
+						captureNext = true;
+					else if (CaptureIsRequired(captureStyle))
+						throw make_exception("Expected a capture argument for flag '", arg[fl], "'!");
+				}
 
-				// validate max arg count limits
-				if (groupOf->_max.has_value() && g.first > groupOf->_max.value()) {
-					throw make_exception("Argument '", *groupOf, "' was specified too many times! (Expected a maximum of ", groupOf->_max.value(), ")");
+				if (convertToParameter) {
+					if (captureNext) // the captured argument is consumed either way
+						i = next(i);
+					emit(ParameterView{ at(i) }, capture_info::npos);
+				}
+				else {
+					for (size_t fl{ 0 }; fl < arg.size(); ++fl) {
+						// single-character names are a table lookup, so this is cheaper than keeping the groups from the loop above
+						const auto& group{ captures.lookup(arg[fl]).group };
+						if (captureNext && fl + 1ull == arg.size())
+							emit(FlagView{ std::make_pair(arg[fl], std::optional<std::string_view>{ at(i = next(i)) }) }, group);
+						else emit(FlagView{ std::make_pair(arg[fl], std::optional<std::string_view>{ std::nullopt }) }, group);
+					}
 				}
+				if (capt.has_value()) // flag captures are always at the end, but parsing them first puts them out of chronological order.
+					emit(std::move(capt.value()), captGroup);
+				if (!invCap.empty()) // add the invalid capture as a parameter
+					emit(ParameterView{ invCap }, capture_info::npos);
 			}
 		}
-		for (const auto& [group, counters] : counts) {
-			// validate arg min limits
-			if (const auto& min{ group->_min }; counters.first < min)
-				throw make_exception("Expected argument '", *group, "' at least ", min, " time!", (min == 1 ? "" : "s"));
 
-			// validate arg conflicts
-			if (counters.first == 0 || group->conflicts.empty())
-				continue;
+		/**
+		 * @brief				Gets the largest number of arguments that tokenize() can produce from args, so containers can be allocated once.
+		 * @param args			A range of arguments that are convertible to std::string_view.
+		 * @param parsingRules	The parser configuration.
+		 * @returns				The upper bound of the number of parsed arguments.
+		 */
+		template<std::ranges::range TArgs>
+		inline size_t max_arg_count(TArgs const& args, const ArgParsingRules& parsingRules)
+		{
+			size_t capacity{ 0 };
+			for (const auto& it : args) {
+				if (const std::string_view arg{ it }; arg.size() < 2ull || !parsingRules.isDelimiter(arg[0]))
+					capacity += 1ull; //< a parameter
+				else if (parsingRules.isDelimiter(arg[1]))
+					capacity += 2ull; //< an option, plus an invalid capture
+				else capacity += arg.size(); //< each flag in a chain, plus an invalid capture
+			}
+			return capacity;
+		}
+
+		/**
+		 * @brief				Gets a capture list with an up-to-date index, without copying it unless it's out-of-date.
+		 * @param captures		The capture list to use.
+		 * @param copy			Receives an indexed copy of captures when its own index is out-of-date.
+		 * @returns				captures when it's indexed; otherwise the copy.
+		 */
+		inline capture_list const& indexed(capture_list const& captures, std::optional<capture_list>& copy)
+		{
+			if (captures.is_indexed())
+				return captures;
+			copy.emplace(captures).reindex();
+			return *copy;
+		}
+		/**
+		 * @brief				Gets the group that an argument is counted toward when parsing with a capture_list.
+		 *\n					Unless strict is true, Parameters are counted toward the group that contains their name, the same as Flags & Options.
+		 * @param captures		The capture list that's being parsed with.
+		 * @param arg			The argument.
+		 * @param group			The group that the tokenizer resolved for arg.
+		 * @param strict		See ArgParsingRules::strictGroupCounts.
+		 * @returns				The group to count arg toward, or capture_info::npos when it isn't counted.
+		 */
+		inline size_t counted_group(capture_list const& captures, variantarg_view const& arg, size_t const& group, bool const strict)
+		{
+			if (group == capture_info::npos && !strict && is_parameter(arg))
+				return captures.lookup(arg.name()).group;
+			return group;
+		}
+	}
 
-			for (const auto& conflict : group->conflicts) {
-				if (const auto& conflictGroup{ captures.get_group_of(conflict.name) }; conflictGroup != captures.end() && counts.contains(conflictGroup)) {
+	/**
+	 * @brief				Parse commandline arguments into an ArgContainer instance.
+	 * @details				### Argument Types
+	 *						- Parameters are any arguments that do not begin with a dash '-' character that were not captured by another argument type.
+	 *						- Options are arguments that begin with 2 dash '-' characters, and can capture additional arguments if the option name appears in the capture list.
+	 *						- Flags are arguments that begin with a single dash '-' character, are a single character in length, and can capture additional arguments. Flags can appear alone, or in "chains" where each character is treated as an individual flag. In a flag chain, only the last flag can capture additional arguments.
+	 *						### Capture Rules
+	 *						- Only options/flags specified in the capture list are allowed to capture additional arguments. Capture list entries should not include a delimiter prefix.
+	 *						- Options/Flags cannot be captured under any circumstance. ex: "--opt --opt captured" results in "--opt", & "--opt" + "captured".
+	 *						- If a flag in a chain should capture an argument (either with an '=' delimiter or by context), it must appear at the end of the chain.
+	 *						- Any captured arguments do not appear in the argument list by themselves, and must be accessed through the argument that captured them.
+	 * @param args			Commandline arguments as a vector of strings, in order and including argv[0].
+	 * @param captureList	A `capture_list` instance specifying which arguments are allowed to capture other arguments as their parameters.
+	 *\n					When its index is out-of-date, a copy of it is indexed instead; call capture_list::reindex() after modifying it to avoid that.
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @returns				ArgContainer
+	 */
+	inline arg_container parse(std::vector<std::string>&& args, capture_list const& captureList, const ArgParsingRules& parsingRules)
+	{
+		std::optional<capture_list> reindexed;
+		const auto& captures{ _internal::indexed(captureList, reindexed) };
 
-					const auto& conflictStyle{ conflict.style.value_or(group->_defaultConflictStyle) };
-					if (conflictStyle == ConflictStyle::None)
-						continue;
+		arg_container cont{};
+		cont.reserve(args.size());
+		auto counter{ captures.make_counter(parsingRules.strictGroupCounts) };
+		_internal::tokenize(args, captures, parsingRules, [&cont, &counter, &captures, &parsingRules](variantarg_view&& arg, size_t const& group) {
+			counter.add(_internal::counted_group(captures, arg, group, parsingRules.strictGroupCounts), arg.has_capture());
+			cont.emplace_back(arg.to_variantarg());
+		});
+		cont.shrink_to_fit();
 
-					const auto& [argCount, capCount] { counts.at(conflictGroup) };
-
-					switch (conflictStyle) {
-					case ConflictStyle::CapturesConflict:
-						if (counters.second > 0ull && capCount > 0ull)
-							throw make_exception("Only one of the following arguments can accept input at the same time: [\n",
-												 indent(14), *group, '\n',
-												 indent(14), *conflictGroup, '\n',
-												 indent(10), ']');
-						break;
-					case ConflictStyle::Conflict:
-						if (counters.first > 0ull && argCount > 0ull)
-							throw make_exception("Argument        ( ", *group, " )\n",
-												 indent(10), "conflicts with: ( ", *conflictGroup, " )"
-							);
-						break;
-					default:break;
-					}
-				}
-			}
-		}
+		captures.validate(counter);
+		cont.build_index();
+		return cont;
+	}
+	/**
+	 * @brief				Parse commandline arguments without copying them, using the same rules as parse().
+	 *\n					Every Parameter, Flag & Option in the result refers directly to the strings in args, so the only allocation is the container itself.
+	 * @param args			Commandline arguments as a random-access range of strings, string_views, or c-strings, in order.
+	 *\n					The result refers to these strings, so they must outlive it; this is always true of argv.
+	 * @param captureList	A `capture_list` instance specifying which arguments are allowed to capture other arguments as their parameters.
+	 *\n					When its index is out-of-date, a copy of it is indexed instead; call capture_list::reindex() after modifying it to avoid that.
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @returns				arg_view_container
+	 */
+	template<std::ranges::random_access_range TArgs> requires std::convertible_to<std::ranges::range_reference_t<TArgs const&>, std::string_view> && (std::is_lvalue_reference_v<TArgs> || std::ranges::borrowed_range<TArgs>)
+	inline arg_view_container parse_view(TArgs&& args, capture_list const& captureList, const ArgParsingRules& parsingRules = {})
+	{
+		std::optional<capture_list> reindexed;
+		const auto& captures{ _internal::indexed(captureList, reindexed) };
+
+		arg_view_container cont{};
+		cont.reserve(_internal::max_arg_count(args, parsingRules));
+		auto counter{ captures.make_counter(parsingRules.strictGroupCounts) };
+		_internal::tokenize(args, captures, parsingRules, [&cont, &counter, &captures, &parsingRules](variantarg_view&& arg, size_t const& group) {
+			counter.add(_internal::counted_group(captures, arg, group, parsingRules.strictGroupCounts), arg.has_capture());
+			cont.emplace_back(std::move(arg));
+		});
+
+		captures.validate(counter);
+		return cont;
+	}
+	/**
+	 * @brief				Parse commandline arguments from main() without copying them, using the same rules as parse().
+	 *\n					Every Parameter, Flag & Option in the result refers directly to the strings in argv.
+	 * @param argc			Argument array size from main.
+	 * @param argv			Argument array from main.
+	 * @param captures		A `capture_list` instance specifying which arguments are allowed to capture other arguments as their parameters
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @param off			The index of the first argument to parse; by default argv[0] is skipped.
+	 * @returns				arg_view_container
+	 */
+	inline arg_view_container parse_view(const int argc, char** argv, capture_list const& captures, const ArgParsingRules& parsingRules = {}, const int off = 1)
+	{
+		return parse_view(std::span<char* const>{ argv + off, argv + std::max(argc, off) }, captures, parsingRules);
+	}
+	/**
+	 * @brief				Parse commandline arguments into an ArgContainer instance, using a schema that was built at compile time instead of a capture_list.
+	 *\n					Arguments are classified with table lookups, and validated with the schema's precomputed count & conflict tables.
+	 * @param args			Commandline arguments as a vector of strings, in order.
+	 * @param captures		A `schema` instance specifying which arguments are allowed to capture other arguments as their parameters.
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @returns				ArgContainer
+	 */
+	template<size_t G, size_t N>
+	inline arg_container parse(std::vector<std::string>&& args, schema<G, N> const& captures, const ArgParsingRules& parsingRules = {})
+	{
+		arg_container cont{};
+		cont.reserve(args.size());
+		auto counter{ captures.make_counter() };
+		_internal::tokenize(args, captures, parsingRules, [&cont, &counter](variantarg_view&& arg, size_t const& group) {
+			counter.add(group, arg.has_capture());
+			cont.emplace_back(arg.to_variantarg());
+		});
+		cont.shrink_to_fit();
 
+		captures.validate(counter);
+		cont.build_index();
 		return cont;
 	}
+	/**
+	 * @brief				Parse commandline arguments without copying them, using a schema that was built at compile time instead of a capture_list.
+	 * @param args			Commandline arguments as a random-access range of strings, string_views, or c-strings, in order.
+	 *\n					The result refers to these strings, so they must outlive it; this is always true of argv.
+	 * @param captures		A `schema` instance specifying which arguments are allowed to capture other arguments as their parameters.
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @returns				arg_view_container
+	 */
+	template<std::ranges::random_access_range TArgs, size_t G, size_t N> requires std::convertible_to<std::ranges::range_reference_t<TArgs const&>, std::string_view> && (std::is_lvalue_reference_v<TArgs> || std::ranges::borrowed_range<TArgs>)
+	inline arg_view_container parse_view(TArgs&& args, schema<G, N> const& captures, const ArgParsingRules& parsingRules = {})
+	{
+		arg_view_container cont{};
+		cont.reserve(_internal::max_arg_count(args, parsingRules));
+		auto counter{ captures.make_counter() };
+		_internal::tokenize(args, captures, parsingRules, [&cont, &counter](variantarg_view&& arg, size_t const& group) {
+			counter.add(group, arg.has_capture());
+			cont.emplace_back(std::move(arg));
+		});
+
+		captures.validate(counter);
+		return cont;
+	}
+	/**
+	 * @brief				Parse commandline arguments from main() without copying them, using a schema that was built at compile time instead of a capture_list.
+	 * @param argc			Argument array size from main.
+	 * @param argv			Argument array from main.
+	 * @param captures		A `schema` instance specifying which arguments are allowed to capture other arguments as their parameters.
+	 * @param parsingRules	An `ArgParsingRules` instance that provides the parser with a configuration
+	 * @param off			The index of the first argument to parse; by default argv[0] is skipped.
+	 * @returns				arg_view_container
+	 */
+	template<size_t G, size_t N>
+	inline arg_view_container parse_view(const int argc, char** argv, schema<G, N> const& captures, const ArgParsingRules& parsingRules = {}, const int off = 1)
+	{
+		return parse_view(std::span<char* const>{ argv + off, argv + std::max(argc, off) }, captures, parsingRules);
+	}
 	/**
 	 * @brief		Make a std::vector of std::strings from a char** array.
 	 * @param sz	Size of the array.
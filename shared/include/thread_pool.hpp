@@ -0,0 +1,130 @@
+/**
+ * @file	thread_pool.hpp
+ * @author	radj307
+ * @brief	Contains the thread_pool object, a fixed-size pool of worker threads that execute queued tasks.
+ */
+#pragma once
+#include <sysarch.h>
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace shared {
+	/**
+	 * @class	thread_pool
+	 * @brief	A fixed-size pool of worker threads that execute tasks in the order they were submitted.
+	 *\n		When the pool is destroyed, all of the tasks that were already submitted are finished before the workers are joined.
+	 *\n		A task must not block waiting for other tasks on the same pool (such as by calling map_chunks or parse_files with it);
+	 *\n		 once every worker is waiting, nothing is left to run the tasks they're waiting for. See is_worker_thread().
+	 */
+	class thread_pool {
+		std::vector<std::thread> workers;
+		std::deque<std::function<void()>> tasks;
+		std::mutex mutex;
+		std::condition_variable cv;
+		bool stopping{ false };
+
+		/// @brief	The pool that owns the calling thread, or nullptr if it isn't a worker thread.
+		static inline thread_local const thread_pool* current{ nullptr };
+
+		void worker_main()
+		{
+			current = this;
+			while (true) {
+				std::function<void()> task;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+					if (tasks.empty())
+						return; //< stopping & nothing left to do
+					task = std::move(tasks.front());
+					tasks.pop_front();
+				}
+				task();
+			}
+		}
+
+	public:
+		/// @returns	The default number of worker threads; this is the number of hardware threads, or 1 if that can't be determined.
+		static size_t default_size() noexcept
+		{
+			return std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		/**
+		 * @brief				Creates a new thread pool.
+		 * @param threadCount	The number of worker threads to create. When this is 0, default_size() is used instead.
+		 * @throws std::system_error	A thread couldn't be created. The threads that were already created are stopped & joined first.
+		 */
+		explicit thread_pool(size_t threadCount = 0)
+		{
+			if (threadCount == 0)
+				threadCount = default_size();
+			workers.reserve(threadCount);
+			try {
+				for (size_t i{ 0 }; i < threadCount; ++i)
+					workers.emplace_back(&thread_pool::worker_main, this);
+			} catch (...) {
+				// the destructor isn't called when the constructor throws, and destroying a joinable std::thread terminates
+				stop();
+				throw;
+			}
+		}
+		thread_pool(thread_pool const&) = delete;
+		thread_pool& operator=(thread_pool const&) = delete;
+		/// @brief	Finishes all of the submitted tasks, then joins all of the worker threads.
+		~thread_pool()
+		{
+			stop();
+		}
+
+		/// @returns	The number of worker threads in the pool.
+		size_t size() const noexcept { return workers.size(); }
+		/// @returns	true when the calling thread is one of this pool's worker threads; otherwise false.
+		bool is_worker_thread() const noexcept { return current == this; }
+
+		/**
+		 * @brief			Queues the given function to be called by one of the worker threads.
+		 * @param func		A callable object.
+		 * @param args		Arguments to pass to func. These are copied/moved into the task.
+		 * @returns			A std::future that receives the return value of func, or the exception that it threw.
+		 */
+		template<class F, class... Args> requires std::invocable<std::decay_t<F>, std::decay_t<Args>...>
+		std::future<std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>> submit(F&& func, Args&&... args)
+		{
+			using result_t = std::invoke_result_t<std::decay_t<F>, std::decay_t<Args>...>;
+
+			// std::function requires copyable targets, so the packaged_task is shared
+			auto task{ std::make_shared<std::packaged_task<result_t()>>(std::bind(std::forward<F>(func), std::forward<Args>(args)...)) };
+			auto future{ task->get_future() };
+			{
+				std::scoped_lock<std::mutex> lock(mutex);
+				tasks.emplace_back([task] { (*task)(); });
+			}
+			cv.notify_one();
+			return future;
+		}
+
+	private:
+		/// @brief	Tells the workers to exit once the queue is empty, then joins them.
+		void stop() noexcept
+		{
+			{
+				std::scoped_lock<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			cv.notify_all();
+			for (auto& worker : workers)
+				worker.join();
+		}
+	};
+}
@@ -0,0 +1,74 @@
+/**
+ * @file	bench.hpp
+ * @brief	Timing helpers shared by the benchmark executables.
+ *\n		Every benchmark accepts "--quick", which shrinks its workload so that ctest can check that it still runs.
+ */
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+namespace bench {
+	/// @brief	Set by init() when "--quick" is passed on the commandline.
+	inline bool quick{ false };
+	/// @brief	Results are added to this so that the compiler can't remove the work that produced them.
+	inline volatile size_t sink{ 0 };
+
+	/// @brief	Parses the benchmark's commandline arguments.
+	inline void init(const int argc, char** argv)
+	{
+		for (int i{ 1 }; i < argc; ++i)
+			if (std::strcmp(argv[i], "--quick") == 0)
+				quick = true;
+	}
+
+	/// @returns	n normally, or 1% of n (at least 1) in quick mode.
+	inline size_t scale(size_t const n) noexcept
+	{
+		return quick ? std::max<size_t>(n / 100, 1) : n;
+	}
+
+	/// @brief	Adds a value to the sink.
+	inline void keep(size_t const v) noexcept { sink = sink + v; }
+
+	/**
+	 * @brief		Calls f the given number of times (once in quick mode), and gets the fastest run.
+	 * @param reps	The number of times to call f.
+	 * @param f		The callable to time.
+	 * @returns		The duration of the fastest call, in milliseconds.
+	 */
+	template<class F>
+	inline double best_of(size_t const reps, F&& f)
+	{
+		double best{ 1e300 };
+		for (size_t r{ 0 }, end{ quick ? 1 : reps }; r < end; ++r) {
+			const auto& t0{ std::chrono::steady_clock::now() };
+			f();
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count());
+		}
+		return best;
+	}
+
+	/// @brief	Prints a heading for a group of results.
+	inline void section(std::string_view const& title)
+	{
+		std::printf("\n%.*s\n", static_cast<int>(title.size()), title.data());
+	}
+	/// @brief	Prints the duration of a benchmark.
+	inline void report(std::string_view const& name, double const ms)
+	{
+		std::printf("  %-36.*s %10.3f ms\n", static_cast<int>(name.size()), name.data(), ms);
+	}
+	/// @brief	Prints the duration of a benchmark, and its throughput in MB/s.
+	inline void report_bytes(std::string_view const& name, double const ms, size_t const bytes)
+	{
+		std::printf("  %-36.*s %10.3f ms %10.1f MB/s\n", static_cast<int>(name.size()), name.data(), ms, bytes / 1e6 / (ms / 1e3));
+	}
+	/// @brief	Prints the duration of a benchmark, and the number of operations per second.
+	inline void report_ops(std::string_view const& name, double const ms, size_t const ops)
+	{
+		std::printf("  %-36.*s %10.3f ms %12.0f ops/s\n", static_cast<int>(name.size()), name.data(), ms, ops / (ms / 1e3));
+	}
+}
@@ -0,0 +1,59 @@
+// Compares appending lines to a file with repeated file::append() calls against file::buffered_writer.
+#include "bench.hpp"
+
+#include <buffered_writer.hpp>
+#include <fileo.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_bench_file_append.log" };
+	const std::string line{ "2026-10-16T12:00:00Z INFO request handled in 12 ms\n" };
+	const size_t slow{ bench::scale(20000) }, fast{ bench::scale(2000000) };
+
+	// every run starts with a new file
+	const auto& run{ [&path](size_t const count, auto&& f) {
+		return bench::best_of(3, [&] {
+			std::filesystem::remove(path);
+			f(count);
+		});
+	} };
+
+	bench::section("File appends (" + std::to_string(line.size()) + " byte lines)");
+
+	bench::report_ops("file::append()", run(slow, [&](size_t const n) {
+		for (size_t i{ 0 }; i < n; ++i)
+			file::append(path, line);
+	}), slow);
+	bench::report_ops("buffered_writer (64 KiB buffer)", run(fast, [&](size_t const n) {
+		file::buffered_writer writer{ path };
+		for (size_t i{ 0 }; i < n; ++i)
+			writer.write(line);
+	}), fast);
+	bench::report_ops("buffered_writer (4 KiB buffer)", run(fast, [&](size_t const n) {
+		file::buffered_writer writer{ path, true, 4096 };
+		for (size_t i{ 0 }; i < n; ++i)
+			writer.write(line);
+	}), fast);
+	bench::report_ops("buffered_writer (1 ms flush interval)", run(fast, [&](size_t const n) {
+		file::buffered_writer writer{ path };
+		writer.set_flush_interval(std::chrono::milliseconds{ 1 });
+		for (size_t i{ 0 }; i < n; ++i)
+			writer.write(line);
+	}), fast);
+	bench::report_ops("buffered_writer (flush every line)", run(slow, [&](size_t const n) {
+		file::buffered_writer writer{ path };
+		for (size_t i{ 0 }; i < n; ++i) {
+			writer.write(line);
+			writer.flush();
+		}
+	}), slow);
+
+	std::filesystem::remove(path);
+	return 0;
+}
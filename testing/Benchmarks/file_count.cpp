@@ -0,0 +1,44 @@
+// Measures the throughput of counting the lines in a file, through a stream, by path, and in memory.
+#include "bench.hpp"
+
+#include <fileutil.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	std::string data;
+	for (size_t i{ 0 }, end{ bench::scale(1000000) }; i < end; ++i)
+		data += "key_" + std::to_string(i) + " = value\n";
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_bench_file_count.txt" };
+	std::ofstream(path, std::ios::binary) << data;
+
+	bench::section("Line count (" + std::to_string(data.size() / 1000) + " KB)");
+
+	bench::report_bytes("std::count(istreambuf_iterator)", bench::best_of(5, [&] {
+		std::ifstream ifs{ path, std::ios::binary };
+		bench::keep(std::count(std::istreambuf_iterator<char>{ ifs }, std::istreambuf_iterator<char>{}, '\n'));
+	}), data.size());
+	bench::report_bytes("getLineCount(std::istream&)", bench::best_of(5, [&] {
+		std::ifstream ifs{ path, std::ios::binary };
+		bench::keep(file::getLineCount(ifs));
+	}), data.size());
+	bench::report_bytes("getLineCount(path)", bench::best_of(5, [&] {
+		bench::keep(file::getLineCount(path));
+	}), data.size());
+	bench::report_bytes("count_bytes_scalar (in memory)", bench::best_of(5, [&] {
+		bench::keep(file::_internal::count_bytes_scalar(data.data(), data.size(), '\n'));
+	}), data.size());
+	bench::report_bytes("count_bytes (in memory)", bench::best_of(5, [&] {
+		bench::keep(file::count_bytes(data.data(), data.size(), '\n'));
+	}), data.size());
+
+	std::filesystem::remove(path);
+	return 0;
+}
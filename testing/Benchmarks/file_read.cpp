@@ -0,0 +1,45 @@
+// Compares the ways of loading a whole file: file::read() into a std::stringstream, file::read_all(), and file::mapped_file.
+// Each variant counts the lines in the file, so that every byte is touched.
+#include "bench.hpp"
+
+#include <filei.hpp>
+#include <mapped_file.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	std::string data;
+	for (size_t i{ 0 }, end{ bench::scale(1000000) }; i < end; ++i)
+		data += "line number " + std::to_string(i) + " of the benchmark file\n";
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_bench_file_read.txt" };
+	std::ofstream(path, std::ios::binary) << data;
+
+	bench::section("File read (" + std::to_string(data.size() / 1000) + " KB)");
+
+	bench::report_bytes("read().str()", bench::best_of(5, [&] {
+		const auto& s{ file::read(path, std::ios_base::binary).str() };
+		bench::keep(std::count(s.begin(), s.end(), '\n'));
+	}), data.size());
+	bench::report_bytes("read_all()", bench::best_of(5, [&] {
+		const auto& s{ file::read_all(path) };
+		bench::keep(std::count(s.begin(), s.end(), '\n'));
+	}), data.size());
+	std::string buffer;
+	bench::report_bytes("read_into() with a reused buffer", bench::best_of(5, [&] {
+		file::read_into(path, buffer);
+		bench::keep(std::count(buffer.begin(), buffer.end(), '\n'));
+	}), data.size());
+	bench::report_bytes("mapped_file", bench::best_of(5, [&] {
+		const file::mapped_file file{ path, file::access_hint::Sequential };
+		bench::keep(std::count(file.begin(), file.end(), '\n'));
+	}), data.size());
+
+	std::filesystem::remove(path);
+	return 0;
+}
@@ -0,0 +1,64 @@
+// Measures basic_ini::get() with 1M lookups, against a container that uses the original str::tolower comparator.
+#include "bench.hpp"
+
+#include <simpleINI.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+	/// @brief	The original case-insensitive comparator, which allocates two lowercase strings per comparison.
+	struct tolower_compare {
+		bool operator()(std::string const& l, std::string const& r) const { return str::tolower(l) == str::tolower(r); }
+	};
+	using tolower_section = std::unordered_map<std::string, ini::ini_value, std::hash<std::string>, tolower_compare>;
+	using tolower_container = std::unordered_map<std::string, tolower_section, std::hash<std::string>, tolower_compare>;
+}
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	const size_t lookups{ bench::scale(1000000) };
+
+	ini::INI ini;
+	tolower_container original;
+	for (int s{ 0 }; s < 20; ++s) {
+		for (int k{ 0 }; k < 500; ++k) {
+			const auto& header{ "Section" + std::to_string(s) }, key{ "SomeLongerKeyName_" + std::to_string(k) };
+			ini.set(header, key, std::string{ "value" });
+			original[header][key] = std::string{ "value" };
+		}
+	}
+	std::vector<std::string> keys, lowerKeys;
+	for (int i{ 0 }; i < 1000; ++i) {
+		keys.emplace_back("SomeLongerKeyName_" + std::to_string(i % 500));
+		lowerKeys.emplace_back(str::tolower(keys.back()));
+	}
+	const std::string header{ "Section3" }, lowerHeader{ "section3" };
+
+	bench::section("INI get() (" + std::to_string(lookups) + " lookups)");
+
+	bench::report_ops("original comparator, same case", bench::best_of(3, [&] {
+		size_t hits{ 0 };
+		for (size_t i{ 0 }; i < lookups; ++i) {
+			const auto& section{ original.find(header) };
+			hits += section != original.end() && section->second.contains(keys[i % keys.size()]);
+		}
+		bench::keep(hits);
+	}), lookups);
+	bench::report_ops("get(), same case", bench::best_of(3, [&] {
+		size_t hits{ 0 };
+		for (size_t i{ 0 }; i < lookups; ++i)
+			hits += ini.get(header, keys[i % keys.size()]).has_value();
+		bench::keep(hits);
+	}), lookups);
+	bench::report_ops("get(), different case", bench::best_of(3, [&] {
+		size_t hits{ 0 };
+		for (size_t i{ 0 }; i < lookups; ++i)
+			hits += ini.get(lowerHeader, lowerKeys[i % lowerKeys.size()]).has_value();
+		bench::keep(hits);
+	}), lookups);
+	return 0;
+}
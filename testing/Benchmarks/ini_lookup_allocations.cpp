@@ -0,0 +1,59 @@
+// Counts the heap allocations made by basic_ini's lookup functions when they're given std::string_view & const char* keys.
+// Exits with 1 when any lookup allocates, so that ctest catches regressions.
+#include "bench.hpp"
+
+#include <simpleINI.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace {
+	size_t allocations{ 0 };
+}
+
+void* operator new(size_t const n)
+{
+	++allocations;
+	if (void* p{ std::malloc(n ? n : 1) })
+		return p;
+	throw std::bad_alloc{};
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	const size_t lookups{ bench::scale(1000000) };
+
+	ini::INI ini;
+	for (int s{ 0 }; s < 20; ++s)
+		for (int k{ 0 }; k < 500; ++k)
+			ini.set("Section" + std::to_string(s), "SomeLongerKeyName_" + std::to_string(k), std::string{ "value" });
+	// keys that are too long for the small string optimization, so that any temporary std::string would allocate
+	ini.set("A Long Header Name For Testing", "A Very Long Key Name That Does Not Fit SSO", std::string{ "1234" });
+
+	const std::string_view header{ "a long header name for testing" };
+	const char* key{ "A VERY LONG KEY NAME THAT DOES NOT FIT SSO" };
+
+	bench::section("INI lookups by std::string_view & const char* (" + std::to_string(lookups) + " iterations)");
+
+	const size_t before{ allocations };
+	bench::report_ops("contains/check/get_if/at/operator()", bench::best_of(3, [&] {
+		size_t hits{ 0 };
+		for (size_t i{ 0 }; i < lookups; ++i) {
+			hits += ini.contains(header, key);
+			hits += ini.check(header, key);
+			hits += ini.get_if(header, key) != nullptr;
+			hits += ini.at(header, key).size() == 4;
+			hits += ini(header, key).size() == 4;
+		}
+		bench::keep(hits);
+	}), lookups * 5);
+	const size_t allocated{ allocations - before };
+
+	std::printf("  %-36s %10zu\n", "heap allocations", allocated);
+	return allocated == 0 ? 0 : 1;
+}
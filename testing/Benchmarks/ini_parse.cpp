@@ -0,0 +1,55 @@
+// Compares the INI parse modes: parse(std::istream&), parse(std::string_view), parse_view(), and parse_file() with & without mapping the file, against the original line-by-line parser.
+#include "bench.hpp"
+#include "ini_reference.hpp"
+
+#include <simpleINI.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	// a large config with hundreds of thousands of keys
+	const size_t sections{ bench::scale(4000) }, keys{ 50 };
+	std::string data;
+	for (size_t s{ 0 }; s < sections; ++s) {
+		data += "[section_" + std::to_string(s) + "]\n; a comment\n";
+		for (size_t k{ 0 }; k < keys; ++k)
+			data += "key_" + std::to_string(k) + " = value number " + std::to_string(s * keys + k) + "\n";
+	}
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_bench_ini_parse.ini" };
+	std::ofstream(path, std::ios::binary) << data;
+
+	bench::section("INI parse (" + std::to_string(sections * keys) + " keys, " + std::to_string(data.size() / 1000) + " KB)");
+
+	bench::report_bytes("original parse(std::istream&)", bench::best_of(5, [&] {
+		std::istringstream is{ data };
+		bench::keep(ini_reference::parse(is).size());
+	}), data.size());
+	bench::report_bytes("parse(std::istream&)", bench::best_of(5, [&] {
+		std::istringstream is{ data };
+		bench::keep(ini::parse(is).size());
+	}), data.size());
+	bench::report_bytes("parse(std::string_view)", bench::best_of(5, [&] {
+		bench::keep(ini::parse(std::string_view{ data }).size());
+	}), data.size());
+	bench::report_bytes("parse_view(std::string_view)", bench::best_of(5, [&] {
+		bench::keep(ini::parse_view(std::string_view{ data }).size());
+	}), data.size());
+	bench::report_bytes("materialize(parse_view())", bench::best_of(5, [&] {
+		bench::keep(ini::materialize(ini::parse_view(std::string_view{ data })).size());
+	}), data.size());
+	bench::report_bytes("parse_file(path)", bench::best_of(5, [&] {
+		bench::keep(ini::parse_file(path).size());
+	}), data.size());
+	bench::report_bytes("parse_file(path, mapFile)", bench::best_of(5, [&] {
+		bench::keep(ini::parse_file(path, {}, true).size());
+	}), data.size());
+
+	std::filesystem::remove(path);
+	return 0;
+}
@@ -0,0 +1,56 @@
+// Compares serializing an INI container with the pre-sized ini_printer against the original stream printer, both in memory & when writing a file.
+#include "bench.hpp"
+#include "ini_reference.hpp"
+
+#include <simpleINI.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	ini::Container container;
+	for (size_t s{ 0 }, end{ bench::scale(5000) }; s < end; ++s)
+		for (int k{ 0 }; k < 40; ++k)
+			container["section" + std::to_string(s)]["key_" + std::to_string(k)] = "value number " + std::to_string(s * k);
+	container[""]["global"] = "1";
+	ini::INI ini;
+	ini.deep_merge(container);
+
+	const ini::Printer printer{ &container };
+	const size_t size{ printer.str().size() };
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_bench_ini_print.ini" };
+
+	bench::section("INI printer (" + std::to_string(size / 1000) + " KB)");
+
+	bench::report_bytes("original operator<<", bench::best_of(5, [&] {
+		std::ostringstream os;
+		ini_reference::print(os, container);
+		bench::keep(os.str().size());
+	}), size);
+	bench::report_bytes("operator<<(ini_printer)", bench::best_of(5, [&] {
+		std::ostringstream os;
+		os << printer;
+		bench::keep(os.str().size());
+	}), size);
+	bench::report_bytes("ini_printer::str()", bench::best_of(5, [&] {
+		bench::keep(printer.str().size());
+	}), size);
+
+	bench::section("INI write (" + std::to_string(size / 1000) + " KB)");
+
+	bench::report_bytes("original operator<< to std::ofstream", bench::best_of(5, [&] {
+		std::ofstream ofs{ path, std::ios::binary | std::ios::trunc };
+		ini_reference::print(ofs, container);
+	}), size);
+	bench::report_bytes("basic_ini::write()", bench::best_of(5, [&] {
+		bench::keep(ini.write(path));
+	}), size);
+
+	std::filesystem::remove(path);
+	return 0;
+}
@@ -0,0 +1,50 @@
+// Measures the throughput of the INI tokenizer on typical files & on pathological ones (quote-heavy values and very long lines), against the original line-by-line parser.
+#include "bench.hpp"
+#include "ini_reference.hpp"
+
+#include <simpleINI.hpp>
+
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	std::mt19937 rng{ 1 };
+	std::string typical, quoted, longLines;
+	for (size_t s{ 0 }, end{ bench::scale(2000) }; s < end; ++s) {
+		typical += "[section" + std::to_string(s) + "]\n; comment line\n";
+		for (int k{ 0 }; k < 25; ++k)
+			typical += "key" + std::to_string(k) + " = value_" + std::to_string(rng() % 100000) + "  # trailing\n";
+	}
+	for (size_t s{ 0 }, end{ bench::scale(2000) }; s < end; ++s) {
+		quoted += "[q" + std::to_string(s) + "]\n";
+		for (int k{ 0 }; k < 25; ++k)
+			quoted += "k" + std::to_string(k) + " = \"a \\\"quoted\\\" ; value with 'single' # not a comment\"   \n";
+	}
+	for (size_t s{ 0 }, end{ bench::scale(200) }; s < end; ++s) {
+		longLines += "[l" + std::to_string(s) + "]\n";
+		for (int k{ 0 }; k < 10; ++k)
+			longLines += "k" + std::to_string(k) + " = " + std::string(2000, 'x') + " \\# escaped " + std::string(2000, 'y') + "\n";
+	}
+
+	for (const auto& [name, data] : std::vector<std::pair<std::string, std::string const*>>{ { "typical", &typical }, { "quoted", &quoted }, { "long lines", &longLines } }) {
+		bench::section("INI tokenizer, " + name + " (" + std::to_string(data->size() / 1000) + " KB)");
+
+		bench::report_bytes("original parse(std::istream&)", bench::best_of(5, [&] {
+			std::istringstream is{ *data };
+			bench::keep(ini_reference::parse(is).size());
+		}), data->size());
+		bench::report_bytes("parse(std::string_view)", bench::best_of(5, [&] {
+			bench::keep(ini::parse(std::string_view{ *data }).size());
+		}), data->size());
+		bench::report_bytes("parse_view(std::string_view)", bench::best_of(5, [&] {
+			bench::keep(ini::parse_view(std::string_view{ *data }).size());
+		}), data->size());
+	}
+	return 0;
+}
@@ -0,0 +1,73 @@
+// Measures repeated ini_value::as<int>() conversions with & without the opt-in conversion cache, against parsing the string every time.
+#include "bench.hpp"
+
+#include <simpleINI.hpp>
+
+#include <charconv>
+#include <string>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	const size_t conversions{ bench::scale(10000000) };
+
+	const ini::ini_value value{ "123456" };
+	ini::ini_value cached{ "123456" };
+	cached.enable_conversion_cache();
+	const std::string str{ "123456" };
+
+	bench::section("ini_value conversions (" + std::to_string(conversions) + " conversions)");
+
+	bench::report_ops("str::tonumber<int>", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const std::string* volatile s{ &str }; //< prevents the conversion from being hoisted out of the loop
+			sum += str::tonumber<int>(*s);
+		}
+		bench::keep(sum);
+	}), conversions);
+	bench::report_ops("std::from_chars", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const std::string* volatile s{ &str };
+			int n{};
+			std::from_chars(s->data(), s->data() + s->size(), n);
+			sum += n;
+		}
+		bench::keep(sum);
+	}), conversions);
+	bench::report_ops("ini_value::as<int>()", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const ini::ini_value* volatile v{ &value };
+			sum += v->as<int>().value();
+		}
+		bench::keep(sum);
+	}), conversions);
+	bench::report_ops("static_cast<int>(ini_value)", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const ini::ini_value* volatile v{ &value };
+			sum += static_cast<int>(*v);
+		}
+		bench::keep(sum);
+	}), conversions);
+	bench::report_ops("ini_value::as<int>(), cached", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const ini::ini_value* volatile v{ &cached };
+			sum += v->as<int>().value();
+		}
+		bench::keep(sum);
+	}), conversions);
+	bench::report_ops("static_cast<int>(ini_value), cached", bench::best_of(3, [&] {
+		size_t sum{ 0 };
+		for (size_t i{ 0 }; i < conversions; ++i) {
+			const ini::ini_value* volatile v{ &cached };
+			sum += static_cast<int>(*v);
+		}
+		bench::keep(sum);
+	}), conversions);
+	return 0;
+}
@@ -0,0 +1,72 @@
+// Measures opt3::parse() & parse_view() on 100k arguments against a capture list with hundreds of templates,
+//  and the argument classification with & without the capture list's name index (an out-of-date index falls back to the original linear scan).
+#include "bench.hpp"
+
+#include <opt3.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+int main(const int argc, char** argv)
+{
+	bench::init(argc, argv);
+
+	opt3::capture_list captures;
+	for (int i{ 0 }; i < 150; ++i)
+		captures.emplace_back(opt3::make_template(opt3::CaptureStyle::Optional, "option-" + std::to_string(i), "alt-" + std::to_string(i)));
+	for (char c{ 'a' }; c <= 'z'; ++c)
+		captures.emplace_back(opt3::make_template(c));
+	captures.emplace_back(opt3::make_template(opt3::CaptureStyle::Disabled, 'Q', "quiet"));
+	captures.reindex();
+
+	std::mt19937 rng{ 1 };
+	std::vector<std::string> args;
+	const size_t count{ bench::scale(100000) };
+	args.reserve(count);
+	for (size_t i{ 0 }; i < count; ++i) {
+		switch (rng() % 6) {
+		case 0: args.emplace_back("--option-" + std::to_string(rng() % 150)); break;
+		case 1: args.emplace_back("--alt-" + std::to_string(rng() % 150) + "=x"); break;
+		case 2: args.emplace_back("-abc"); break;
+		case 3: args.emplace_back("-Q"); break;
+		case 4: args.emplace_back("param" + std::to_string(i)); break;
+		default: args.emplace_back("--unknown-" + std::to_string(i)); break;
+		}
+	}
+
+	// adding a group without reindexing leaves the index out of date, so every lookup scans each template of each group
+	opt3::capture_list unindexed{ captures };
+	unindexed.emplace_back(opt3::make_template('!'));
+	const opt3::ArgParsingRules rules;
+
+	bench::section("opt3 argument classification (" + std::to_string(count) + " args, " + std::to_string(captures.size()) + " groups)");
+	bench::report_ops("tokenize, linear scan", bench::best_of(1, [&] {
+		size_t n{ 0 };
+		opt3::_internal::tokenize(args, unindexed, rules, [&n](opt3::variantarg_view&&, size_t const& group) { n += group; });
+		bench::keep(n);
+	}), count);
+	bench::report_ops("tokenize, indexed", bench::best_of(5, [&] {
+		size_t n{ 0 };
+		opt3::_internal::tokenize(args, captures, rules, [&n](opt3::variantarg_view&&, size_t const& group) { n += group; });
+		bench::keep(n);
+	}), count);
+
+	bench::section("opt3 parsing (" + std::to_string(count) + " args)");
+	bench::report_ops("parse(), including the copy of args", bench::best_of(5, [&] {
+		bench::keep(opt3::parse(std::vector<std::string>{ args }, captures, rules).size());
+	}), count);
+	bench::report_ops("parse_view()", bench::best_of(5, [&] {
+		bench::keep(opt3::parse_view(args, captures, rules).size());
+	}), count);
+
+	// a typical command line is short, so the fixed cost of each call matters more than the cost of each argument
+	const std::vector<std::string> shortArgs{ "-abc", "--option-1", "x", "--alt-2=y", "param", "-Q" };
+	const size_t calls{ bench::scale(10000) };
+	bench::section("opt3 parsing (" + std::to_string(shortArgs.size()) + " args, " + std::to_string(calls) + " calls)");
+	bench::report_ops("parse_view()", bench::best_of(5, [&] {
+		for (size_t i{ 0 }; i < calls; ++i)
+			bench::keep(opt3::parse_view(shortArgs, captures, rules).size());
+	}), calls);
+	return 0;
+}
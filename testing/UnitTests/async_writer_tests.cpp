@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <async_writer.hpp>
+#include <filei.hpp>
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	/**
+	 * @brief			Writes numbered lines from several threads at once, then checks that each thread's lines appear in the file in order.
+	 * @param policy	The overflow policy to use.
+	 * @param capacity	The queue capacity; small capacities force the queue to overflow.
+	 * @returns			The number of lines found in the file.
+	 */
+	size_t write_concurrently(file::overflow_policy const policy, size_t const capacity, int const threads, int const lines)
+	{
+		const auto& path{ std::filesystem::temp_directory_path() / "307lib_async_writer.txt" };
+		{
+			file::async_writer writer{ path, false, policy, capacity, 256 };
+			std::vector<std::thread> producers;
+			for (int t{ 0 }; t < threads; ++t) {
+				producers.emplace_back([&writer, t, lines] {
+					for (int i{ 0 }; i < lines; ++i)
+						writer.write(std::to_string(t) + ' ' + std::to_string(i) + '\n');
+				});
+			}
+			for (auto& producer : producers)
+				producer.join();
+			EXPECT_TRUE(writer.flush());
+		}
+
+		std::vector<int> next(threads, 0);
+		std::istringstream is{ file::read_all(path) };
+		size_t count{ 0 };
+		for (int t, i; is >> t >> i; ++count) {
+			EXPECT_GE(i, next.at(t)) << "thread " << t << " wrote line " << i << " out of order";
+			next.at(t) = i + 1;
+		}
+		std::filesystem::remove(path);
+		return count;
+	}
+}
+
+TEST(async_writer, BlockKeepsEveryThreadsOrder)
+{
+	EXPECT_EQ(write_concurrently(file::overflow_policy::Block, 4, 4, 5000), 20000u);
+}
+
+// with a tiny queue, most messages go through the overflow list & must still be written in each thread's order
+TEST(async_writer, GrowKeepsEveryThreadsOrder)
+{
+	for (int run{ 0 }; run < 20; ++run)
+		ASSERT_EQ(write_concurrently(file::overflow_policy::Grow, 2, 4, 2000), 8000u);
+}
+
+TEST(async_writer, DropCountsDroppedWrites)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_async_writer_drop.txt" };
+	size_t dropped;
+	{
+		file::async_writer writer{ path, false, file::overflow_policy::Drop, 2 };
+		for (int i{ 0 }; i < 10000; ++i)
+			writer.write(std::string{ "line\n" });
+		EXPECT_TRUE(writer.flush());
+		dropped = writer.dropped();
+	}
+	EXPECT_EQ(file::read_all(path).size(), (10000 - dropped) * 5);
+	std::filesystem::remove(path);
+}
+
+TEST(async_writer, FlushWaitsForEarlierWrites)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_async_writer_flush.txt" };
+	{
+		file::async_writer writer{ path, false };
+		writer.write(std::string_view{ "first\n" });
+		ASSERT_TRUE(writer.flush());
+		EXPECT_EQ(file::read_all(path), "first\n");
+		writer.write(std::string_view{ "second\n" });
+		ASSERT_TRUE(writer.sync());
+		EXPECT_EQ(file::read_all(path), "first\nsecond\n");
+		EXPECT_TRUE(writer.good());
+	}
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <buffered_writer.hpp>
+#include <filei.hpp>
+
+#include <filesystem>
+#include <ostream>
+#include <random>
+#include <string>
+
+namespace {
+	struct streamable {
+		int x;
+		friend std::ostream& operator<<(std::ostream& os, streamable const& s) { return os << "S(" << s.x << ')'; }
+	};
+}
+
+// whatever the buffer size, the file must contain exactly what was written, in order
+TEST(buffered_writer, WritesEverythingInOrder)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_buffered_writer.txt" };
+	std::mt19937 rng{ 9 };
+	for (int t{ 0 }; t < 50; ++t) {
+		std::filesystem::remove(path);
+		std::string expected;
+		{
+			file::buffered_writer writer{ path, false, 1 + rng() % 300 };
+			for (int i{ 0 }; i < 300; ++i) {
+				switch (rng() % 4) {
+				case 0: {
+					const std::string s(rng() % 700, static_cast<char>('a' + rng() % 26));
+					writer.write(s);
+					expected += s;
+					break;
+				}
+				case 1: {
+					const char c{ static_cast<char>('A' + rng() % 26) };
+					writer.put(c);
+					expected += c;
+					break;
+				}
+				case 2: {
+					const int n{ static_cast<int>(rng() % 2000000) - 1000000 };
+					writer << n;
+					expected += std::to_string(n);
+					break;
+				}
+				default:
+					writer << streamable{ 5 } << '\n';
+					expected += "S(5)\n";
+					break;
+				}
+			}
+			ASSERT_TRUE(writer.good());
+		}
+		ASSERT_EQ(file::read_all(path), expected);
+	}
+	std::filesystem::remove(path);
+}
+
+TEST(buffered_writer, AppendsToExistingFiles)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_buffered_writer_append.txt" };
+	std::filesystem::remove(path);
+	{ file::buffered_writer writer{ path }; writer << "head\n"; }
+	{ file::buffered_writer writer{ path }; writer << "tail\n"; }
+	EXPECT_EQ(file::read_all(path), "head\ntail\n");
+	std::filesystem::remove(path);
+}
+
+TEST(buffered_writer, ReportsOpenErrors)
+{
+	std::error_code ec;
+	file::buffered_writer writer{ "/nonexistent_307lib_dir/file.txt", ec };
+	EXPECT_TRUE(ec);
+	EXPECT_FALSE(writer.is_open());
+	EXPECT_FALSE(writer.write("x"));
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <chunked_file.hpp>
+#include <fileutil.hpp>
+#include <thread_pool.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	/// @returns	A buffer of random lines with lengths of up to maxLineLength, containing only the characters in alphabet.
+	std::string random_lines(std::mt19937& rng, size_t const size, size_t const maxLineLength, std::string_view const& alphabet = "abc")
+	{
+		std::string buffer;
+		buffer.reserve(size);
+		while (buffer.size() < size) {
+			buffer.append(rng() % maxLineLength, alphabet[rng() % alphabet.size()]);
+			buffer += '\n';
+		}
+		buffer.resize(size);
+		return buffer;
+	}
+
+	/// @returns	The offset of every (possibly overlapping) occurrence of needle in buffer, found one at a time.
+	std::vector<size_t> find_all_reference(std::string_view const& buffer, std::string_view const& needle)
+	{
+		std::vector<size_t> offsets;
+		for (size_t pos{ buffer.find(needle) }; pos != std::string_view::npos; pos = buffer.find(needle, pos + 1))
+			offsets.emplace_back(pos);
+		return offsets;
+	}
+
+	/// @brief	Checks that ranges cover all of buffer in order, without overlapping, & that every range except the last ends just after a newline.
+	void expect_aligned(std::string_view const& buffer, std::vector<file::byte_range> const& ranges)
+	{
+		size_t expectedBegin{ 0 };
+		for (size_t i{ 0 }; i < ranges.size(); ++i) {
+			const auto& range{ ranges[i] };
+			EXPECT_EQ(range.begin, expectedBegin);
+			EXPECT_FALSE(range.empty());
+			if (i + 1 < ranges.size())
+				EXPECT_EQ(buffer[range.end - 1], '\n') << "range " << i << " ends in the middle of a line";
+			expectedBegin = range.end;
+		}
+		EXPECT_EQ(expectedBegin, buffer.size());
+	}
+}
+
+TEST(chunked_file, SplitLinesCoversTheBufferAtLineBoundaries)
+{
+	EXPECT_TRUE(file::split_lines("", 4, 1).empty());
+	EXPECT_EQ(file::split_lines("no newline", 4, 1), (std::vector<file::byte_range>{ file::byte_range{ 0, 10 } }));
+
+	std::mt19937 rng{ 3 };
+	for (int i{ 0 }; i < 500; ++i) {
+		const auto& buffer{ random_lines(rng, 1 + rng() % 2000, 1 + rng() % 300) };
+		const size_t chunkCount{ 1 + rng() % 16 };
+		const auto& ranges{ file::split_lines(buffer, chunkCount, 1) };
+		ASSERT_LE(ranges.size(), chunkCount);
+		expect_aligned(buffer, ranges);
+	}
+}
+
+TEST(chunked_file, SplitLinesRespectsTheMinimumChunkSize)
+{
+	std::mt19937 rng{ 4 };
+	const auto& buffer{ random_lines(rng, 10000, 20) };
+
+	// 10000 bytes only fit 4 chunks of at least 2500 bytes, no matter how many were requested
+	const auto& ranges{ file::split_lines(buffer, 16, 2500) };
+	EXPECT_EQ(ranges.size(), 4u);
+	expect_aligned(buffer, ranges);
+	for (size_t i{ 0 }; i + 1 < ranges.size(); ++i)
+		EXPECT_GE(ranges[i].size(), 2500u - 20u); //< boundaries move forward to the next newline, which is at most one line away
+
+	// buffers smaller than the minimum aren't split at all
+	EXPECT_EQ(file::split_lines(buffer, 16).size(), 1u);
+	EXPECT_EQ(file::split_lines(buffer, 16, buffer.size() + 1).size(), 1u);
+	// a minimum of 0 is treated as 1
+	EXPECT_EQ(file::split_lines(buffer, 16, 0).size(), 16u);
+}
+
+// an occurrence that starts in one chunk & ends in the next must be found exactly once
+TEST(chunked_file, FindAllFindsNeedlesThatStraddleChunks)
+{
+	shared::thread_pool pool{ 4 };
+	std::mt19937 rng{ 5 };
+	auto buffer{ random_lines(rng, file::MIN_CHUNK_SIZE * 8, 200, "xyz") };
+	const auto& ranges{ file::split_lines(buffer, pool.size()) };
+	ASSERT_EQ(ranges.size(), pool.size());
+
+	// place the needle's newline on the newline that ends each chunk, so the chunk boundaries stay where they were
+	const std::string_view needle{ "AB\nCD" };
+	std::vector<size_t> expected;
+	for (size_t i{ 0 }; i + 1 < ranges.size(); ++i) {
+		const size_t pos{ ranges[i].end - 3 };
+		buffer.replace(pos, needle.size(), needle);
+		expected.emplace_back(pos);
+	}
+	ASSERT_EQ(file::split_lines(buffer, pool.size()), ranges);
+
+	EXPECT_EQ(file::find_all(buffer.data(), buffer.size(), needle, pool), expected);
+}
+
+TEST(chunked_file, FindAllFindsOverlappingMatches)
+{
+	shared::thread_pool pool{ 4 };
+	EXPECT_EQ(file::find_all("aaaa", 4, "aa", pool), (std::vector<size_t>{ 0, 1, 2 }));
+	EXPECT_TRUE(file::find_all("aaaa", 4, "", pool).empty());
+
+	std::mt19937 rng{ 6 };
+	const auto& buffer{ random_lines(rng, file::MIN_CHUNK_SIZE * 6, 8, "ab") };
+	for (const std::string_view needle : { "a", "aa", "a\na", "ab\nba", "\n\n" })
+		EXPECT_EQ(file::find_all(buffer.data(), buffer.size(), needle, pool), find_all_reference(buffer, needle)) << "needle: " << needle;
+}
+
+TEST(chunked_file, CountMatchesTheSingleThreadedCount)
+{
+	shared::thread_pool pool{ 4 };
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_chunked_file_count.txt" };
+	std::mt19937 rng{ 7 };
+	for (const size_t size : { size_t{ 0 }, size_t{ 100 }, file::MIN_CHUNK_SIZE * 5 + 17 }) {
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << random_lines(rng, size, 100);
+
+		EXPECT_EQ(file::getLineCount(path, pool), file::getLineCount(path)) << "size " << size;
+		EXPECT_EQ(file::count(path, 'a', pool), file::count(path, 'a')) << "size " << size;
+
+		const file::chunked_file chunked{ path };
+		EXPECT_EQ(chunked.size(), size);
+		EXPECT_EQ(file::getLineCount(chunked, pool), file::getLineCount(path)) << "size " << size;
+	}
+	std::filesystem::remove(path);
+
+	EXPECT_EQ(file::getLineCount(path, pool), 0);
+}
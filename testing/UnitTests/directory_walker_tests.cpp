@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <directory_walker.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+	/// @brief	Creates a small directory tree for a test, and removes it afterwards.
+	struct temp_tree {
+		std::filesystem::path dir;
+
+		temp_tree() : dir{ std::filesystem::temp_directory_path() / ("307lib_walker_" + std::string{ ::testing::UnitTest::GetInstance()->current_test_info()->name() }) }
+		{
+			for (const auto& sub : { "a", "a/deep", "b", "c" })
+				std::filesystem::create_directories(dir / sub);
+			for (const auto& file : { "root.txt", "a/1.txt", "a/deep/2.txt", "a/deep/3.log", "b/4.txt", "c/5.txt" })
+				std::ofstream{ dir / file } << file;
+		}
+		~temp_tree()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(dir, ec);
+		}
+
+		std::vector<std::string> relative(std::vector<std::filesystem::path> const& paths) const
+		{
+			std::vector<std::string> out;
+			for (const auto& path : paths)
+				out.emplace_back(std::filesystem::relative(path, dir).generic_string());
+			std::sort(out.begin(), out.end());
+			return out;
+		}
+	};
+}
+
+TEST(directory_walker, RangeAndWalkAgree)
+{
+	temp_tree tree;
+	file::walk_options options;
+	options.extensions = { ".txt" };
+
+	std::vector<std::filesystem::path> walked, ranged;
+	std::mutex mutex;
+	const auto& result{ file::walk(tree.dir, [&](std::filesystem::directory_entry const& entry) {
+		std::scoped_lock<std::mutex> lock(mutex);
+		walked.push_back(entry.path());
+	}, options, 3) };
+	for (const auto& entry : file::directory_walk_range{ tree.dir, options })
+		ranged.push_back(entry.path());
+
+	const std::vector<std::string> expected{ "a/1.txt", "a/deep/2.txt", "b/4.txt", "c/5.txt", "root.txt" };
+	EXPECT_EQ(tree.relative(walked), expected);
+	EXPECT_EQ(tree.relative(ranged), expected);
+	EXPECT_EQ(result.matched, 5u);
+	EXPECT_EQ(result.directories, 5u);
+	EXPECT_EQ(result.errors, 0u);
+}
+
+// a directory that can't be read is skipped & counted, and the rest of the tree is still visited
+TEST(directory_walker, SkipsDirectoriesThatCantBeRead)
+{
+	temp_tree tree;
+	file::walk_options options;
+	options.extensions = { ".txt" };
+	// removing the directory once it's been listed makes opening it fail with ENOENT, which skip_permission_denied doesn't cover
+	options.directoryFilter = [](std::filesystem::directory_entry const& entry) {
+		if (entry.path().filename() == "b")
+			std::filesystem::remove_all(entry.path());
+		return true;
+	};
+
+	std::vector<std::filesystem::path> ranged;
+	file::directory_walk_range range{ tree.dir, options };
+	for (const auto& entry : range)
+		ranged.push_back(entry.path());
+	EXPECT_EQ(tree.relative(ranged), (std::vector<std::string>{ "a/1.txt", "a/deep/2.txt", "c/5.txt", "root.txt" }));
+	EXPECT_EQ(range.errors(), 1u);
+
+	temp_tree again;
+	std::vector<std::filesystem::path> walked;
+	const auto& result{ file::walk(again.dir, [&](std::filesystem::directory_entry const& entry) { walked.push_back(entry.path()); }, options, 1) };
+	EXPECT_EQ(again.relative(walked), (std::vector<std::string>{ "a/1.txt", "a/deep/2.txt", "c/5.txt", "root.txt" }));
+	EXPECT_EQ(result.errors, 1u);
+}
+
+TEST(directory_walker, RangeRespectsMaxDepth)
+{
+	temp_tree tree;
+	file::walk_options options;
+	options.includeDirectories = true;
+	options.maxDepth = 0;
+
+	std::vector<std::filesystem::path> ranged;
+	for (const auto& entry : file::directory_walk_range{ tree.dir, options })
+		ranged.push_back(entry.path());
+	EXPECT_EQ(tree.relative(ranged), (std::vector<std::string>{ "a", "b", "c", "root.txt" }));
+}
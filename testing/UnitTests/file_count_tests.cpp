@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <fileutil.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// every implementation of count_bytes must agree with std::count, for any length & alignment
+TEST(file_count, CountBytesMatchesStdCount)
+{
+	std::mt19937 rng{ 1 };
+	for (int i{ 0 }; i < 2000; ++i) {
+		const size_t size{ rng() % 5000 }, offset{ rng() % 32 };
+		std::vector<char> data(size + offset);
+		for (auto& c : data)
+			c = (rng() % 4 == 0) ? '\n' : static_cast<char>(rng());
+		const char ch{ (i % 5 == 0) ? static_cast<char>(rng()) : '\n' };
+
+		const char* begin{ data.data() + offset };
+		const size_t expected{ static_cast<size_t>(std::count(begin, begin + size, ch)) };
+		ASSERT_EQ(file::_internal::count_bytes_scalar(begin, size, ch), expected);
+	#ifdef FILELIB_SSE2
+		ASSERT_EQ(file::_internal::count_bytes_sse2(begin, size, ch), expected);
+	#endif
+	#ifdef FILELIB_AVX2
+		if (file::_internal::has_avx2()) {
+			ASSERT_EQ(file::_internal::count_bytes_avx2(begin, size, ch), expected);
+		}
+	#endif
+		ASSERT_EQ(file::count_bytes(begin, size, ch), expected);
+	}
+}
+
+TEST(file_count, CountsStreamsLargerThanOneBlock)
+{
+	const std::string data(200000, 'x');
+	std::string lines{ data };
+	for (size_t i{ 0 }; i < lines.size(); i += 7)
+		lines[i] = '\n';
+
+	std::istringstream is{ lines };
+	EXPECT_EQ(file::getLineCount(is), std::count(lines.begin(), lines.end(), '\n'));
+}
+
+// the stream must be rewound even when an earlier extraction left it in a failed state
+TEST(file_count, RewindsTheStream)
+{
+	std::istringstream is{ "a\nb\nc" };
+	int n;
+	is >> n; //< sets failbit
+	ASSERT_TRUE(is.fail());
+
+	EXPECT_EQ(file::getLineCount(is), 2);
+	std::string line;
+	EXPECT_TRUE(std::getline(is, line));
+	EXPECT_EQ(line, "a");
+}
+
+TEST(file_count, CountsFiles)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_file_count.txt" };
+	std::ofstream(path, std::ios::binary) << "one\ntwo\nthree\n";
+
+	EXPECT_EQ(file::getLineCount(path), 3);
+	std::ifstream ifs{ path, std::ios::binary };
+	EXPECT_EQ(file::getLineCount(ifs), 3);
+
+	std::filesystem::remove(path);
+}
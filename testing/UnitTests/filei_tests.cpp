@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <filei.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+	/// @brief	A temporary file that's removed when the test finishes.
+	struct temp_file {
+		std::filesystem::path path;
+
+		temp_file(std::string const& content) : path{ std::filesystem::temp_directory_path() / ("307lib_filei_" + std::string{ ::testing::UnitTest::GetInstance()->current_test_info()->name() }) }
+		{
+			std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+		}
+		~temp_file()
+		{
+			std::error_code ec;
+			std::filesystem::remove(path, ec);
+		}
+	};
+}
+
+TEST(filei, ReadIntoReusesTheBuffer)
+{
+	const temp_file file{ std::string(100000, 'x') + "end" };
+	std::string buffer;
+	file::read_into(file.path, buffer);
+	EXPECT_EQ(buffer.size(), 100003u);
+	EXPECT_EQ(buffer.substr(buffer.size() - 3), "end");
+
+	const temp_file small{ "abc" };
+	const auto* const storage{ buffer.data() };
+	file::read_into(small.path, buffer);
+	EXPECT_EQ(buffer, "abc");
+	EXPECT_EQ(buffer.data(), storage);
+
+	EXPECT_EQ(file::read_bytes(small.path), (std::vector<std::byte>{ std::byte{ 'a' }, std::byte{ 'b' }, std::byte{ 'c' } }));
+	EXPECT_EQ(file::read_all(small.path), "abc");
+}
+
+// data that's appended after the file was opened must not be cut off at the size it had back then
+TEST(filei, ReadIntoReadsFilesThatGrewUntilTheEnd)
+{
+	const temp_file file{ "abc" };
+	std::error_code ec;
+	file::_internal::read_handle handle{ file.path, ec };
+	ASSERT_FALSE(ec);
+	ASSERT_EQ(handle.size(), 3u);
+
+	const std::string appended(200000, 'y');
+	std::ofstream(file.path, std::ios::binary | std::ios::app) << appended;
+
+	std::string buffer;
+	file::_internal::read_to_end(handle, buffer, ec);
+	EXPECT_FALSE(ec);
+	EXPECT_EQ(buffer, "abc" + appended);
+}
+
+TEST(filei, ReadIntoReportsMissingFiles)
+{
+	std::string buffer{ "old" };
+	std::error_code ec;
+	file::read_into(std::filesystem::temp_directory_path() / "307lib_filei_missing", buffer, ec);
+	EXPECT_EQ(ec, std::errc::no_such_file_or_directory);
+	EXPECT_TRUE(buffer.empty());
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <fileo.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+namespace {
+	/// @brief	Creates a temporary directory for a test's files, and removes it afterwards.
+	struct temp_dir {
+		std::filesystem::path dir;
+
+		temp_dir() : dir{ std::filesystem::temp_directory_path() / ("307lib_fileo_" + std::string{ ::testing::UnitTest::GetInstance()->current_test_info()->name() }) }
+		{
+			std::filesystem::create_directories(dir);
+		}
+		~temp_dir()
+		{
+			std::error_code ec;
+			std::filesystem::permissions(dir, std::filesystem::perms::owner_all, std::filesystem::perm_options::add, ec);
+			std::filesystem::remove_all(dir, ec);
+		}
+
+		std::filesystem::path path(std::string const& name) const { return dir / name; }
+	};
+
+	std::string read(std::filesystem::path const& path)
+	{
+		std::ifstream ifs{ path, std::ios::binary };
+		std::stringstream ss;
+		ss << ifs.rdbuf();
+		return ss.str();
+	}
+}
+
+TEST(fileo, WriteReplacesTheFile)
+{
+	temp_dir tmp;
+	EXPECT_TRUE(file::write(tmp.path("a.txt"), "hello ", 42));
+	EXPECT_EQ(read(tmp.path("a.txt")), "hello 42");
+	EXPECT_TRUE(file::write(tmp.path("a.txt"), "x"));
+	EXPECT_EQ(read(tmp.path("a.txt")), "x");
+	EXPECT_EQ(std::distance(std::filesystem::directory_iterator{ tmp.dir }, {}), 1); //< no temporary files are left behind
+}
+
+TEST(fileo, WriteAtomicDurablyReplacesTheFile)
+{
+	temp_dir tmp;
+	const auto& path{ tmp.path("a.txt") };
+	std::ofstream{ path } << "old";
+	std::error_code ec;
+	EXPECT_TRUE(file::write_atomic(path, "new", true, ec));
+	EXPECT_FALSE(ec) << ec.message();
+	EXPECT_EQ(read(path), "new");
+
+	// failures that happen before the rename leave the file unchanged, & are reported by both the return value & ec
+	EXPECT_FALSE(file::write_atomic(tmp.path("missing") / "a.txt", "new", true, ec));
+	EXPECT_TRUE(ec);
+}
+
+#ifndef _WIN32
+TEST(fileo, WriteAtomicKeepsThePermissionsOfExistingFiles)
+{
+	temp_dir tmp;
+	const auto& path{ tmp.path("a.txt") };
+	std::ofstream{ path } << "old";
+	ASSERT_EQ(::chmod(path.c_str(), 0666), 0);
+
+	ASSERT_TRUE(file::write_atomic(path, "new"));
+	struct stat st {};
+	ASSERT_EQ(::stat(path.c_str(), &st), 0);
+	EXPECT_EQ(st.st_mode & 07777, 0666u);
+	EXPECT_EQ(read(path), "new");
+}
+
+// targets that a rename would detach or can't replace at all must be written in place
+TEST(fileo, WriteFallsBackForFilesThatCantBeReplaced)
+{
+	EXPECT_TRUE(file::write("/dev/null", "discarded"));
+	EXPECT_TRUE(std::filesystem::is_character_file("/dev/null"));
+
+	temp_dir tmp;
+	const auto& original{ tmp.path("original.txt") }, link{ tmp.path("link.txt") };
+	std::ofstream{ original } << "old";
+	std::filesystem::create_hard_link(original, link);
+	EXPECT_TRUE(file::write(link, "new"));
+	EXPECT_EQ(read(original), "new");
+	EXPECT_EQ(std::filesystem::hard_link_count(original), 2u);
+
+	const auto& readonly{ tmp.path("readonly") };
+	std::filesystem::create_directory(readonly);
+	std::ofstream{ readonly / "a.txt" } << "old";
+	std::filesystem::permissions(readonly, std::filesystem::perms::owner_read | std::filesystem::perms::owner_exec);
+	EXPECT_TRUE(file::write(readonly / "a.txt", "new"));
+	EXPECT_EQ(read(readonly / "a.txt"), "new");
+}
+#endif
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <simpleINI.hpp>
+
+#include <string>
+#include <utility>
+
+namespace {
+	ini::FrozenINI make_frozen()
+	{
+		ini::INI ini;
+		// short strings, so that the whole pool would fit in a std::string's small buffer
+		ini.set("s", "k", std::string{ "v" });
+		ini.set("t", "a", std::string{ "b" });
+		return ini.freeze();
+	}
+}
+
+TEST(ini_frozen, LooksUpHeadersAndKeys)
+{
+	const auto& frozen{ make_frozen() };
+
+	EXPECT_EQ(frozen.size(), 2u);
+	EXPECT_EQ(frozen.at("S", "K"), "v");
+	EXPECT_EQ(frozen.get_view("t", "a").value(), "b");
+	EXPECT_FALSE(frozen.contains("s", "a"));
+	EXPECT_THROW(frozen.at("missing"), std::out_of_range);
+}
+
+// views & iterators must keep working after the instance that created them is moved
+TEST(ini_frozen, ViewsSurviveMove)
+{
+	auto frozen{ make_frozen() };
+	const auto view{ frozen.at("s") };
+	const auto it{ frozen.find("t") };
+	const auto value{ frozen.at("s", "k") };
+
+	ini::FrozenINI moved{ std::move(frozen) };
+	ini::FrozenINI assigned;
+	assigned = std::move(moved);
+
+	EXPECT_EQ(view.header(), "s");
+	EXPECT_EQ(view.at("k"), "v");
+	EXPECT_EQ((*view.begin()).second, "v");
+	EXPECT_EQ((*it).first, "t");
+	EXPECT_EQ((*it).second.at("a"), "b");
+	EXPECT_EQ(value, "v");
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <simpleINI.hpp>
+
+#include <cstring>
+#include <random>
+#include <string>
+
+// fold_word must lowercase exactly the bytes that str::tolower(char) changes, in every position of the word
+TEST(ini_keys, FoldWordMatchesToLower)
+{
+	for (int c{ 0 }; c < 256; ++c) {
+		for (size_t pos{ 0 }; pos < sizeof(uint64_t); ++pos) {
+			unsigned char bytes[sizeof(uint64_t)]{ 'A', 'B', 'a', 'z', 'Z', '[', '@', '`' };
+			bytes[pos] = static_cast<unsigned char>(c);
+			uint64_t word;
+			std::memcpy(&word, bytes, sizeof(word));
+
+			const uint64_t folded{ ini::_internal::fold_word(word) };
+			unsigned char result[sizeof(uint64_t)];
+			std::memcpy(result, &folded, sizeof(folded));
+			for (size_t i{ 0 }; i < sizeof(uint64_t); ++i)
+				ASSERT_EQ(result[i], static_cast<unsigned char>(str::tolower(static_cast<char>(bytes[i])))) << "byte " << c << " at " << pos;
+		}
+	}
+}
+
+// keys that compare equal must hash the same, and the comparator must agree with a str::tolower comparison
+TEST(ini_keys, CaseInsensitiveHashAgreesWithCompare)
+{
+	static constexpr char alphabet[]{ "aAbBzZ[@`{_09\xC1\xE1" };
+	const ini::CaseInsensitiveCompare equal;
+	const ini::CaseInsensitiveHash hash;
+	std::mt19937 rng{ 1 };
+
+	for (int i{ 0 }; i < 100000; ++i) {
+		std::string a(rng() % 40, 'x');
+		for (auto& ch : a)
+			ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+		std::string b{ a };
+		for (auto& ch : b)
+			if (rng() % 2)
+				ch = str::toupper(ch);
+
+		ASSERT_TRUE(equal(a, b)) << a << " / " << b;
+		ASSERT_EQ(hash(a), hash(b)) << a << " / " << b;
+
+		if (!b.empty()) {
+			b[rng() % b.size()] = '#';
+			ASSERT_EQ(equal(a, b), str::tolower(a) == str::tolower(b)) << a << " / " << b;
+		}
+	}
+}
+
+TEST(ini_keys, LookupsIgnoreCase)
+{
+	ini::INI ini;
+	ini.set("Section", "SomeLongerKeyName", std::string{ "value" });
+
+	EXPECT_TRUE(ini.contains("SECTION", "somelongerkeyname"));
+	EXPECT_EQ(ini.get("section", "SOMELONGERKEYNAME").value(), "value");
+	EXPECT_FALSE(ini.contains("section", "somelongerkeyname_"));
+}
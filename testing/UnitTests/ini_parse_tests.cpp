@@ -0,0 +1,296 @@
+#include <gtest/gtest.h>
+
+#include <simpleINI.hpp>
+#include "ini_reference.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace {
+	using sorted_ini = std::map<std::string, std::map<std::string, std::string>>;
+
+	template<class TContainer>
+	sorted_ini sorted(TContainer const& ini)
+	{
+		sorted_ini out;
+		for (const auto& [header, section] : ini) {
+			auto& s{ out[std::string{ header }] };
+			for (const auto& [key, value] : section)
+				s[std::string{ key }] = std::string{ value };
+		}
+		return out;
+	}
+
+	/// @brief	Generates random INI-like text that's dense in brackets, quotes, escapes & comments.
+	std::string random_ini(std::mt19937& rng)
+	{
+		static constexpr const char* tokens[]{ "[", "] ", "]", "=", "\"", "'", "\\", "#", ";", " ", "\t", "a", "B", "key", "val", "\r", "x y" };
+		std::string out;
+		for (size_t lines{ 1 + rng() % 30 }; lines > 0; --lines) {
+			for (size_t n{ rng() % 13 }; n > 0; --n)
+				out += tokens[rng() % std::size(tokens)];
+			out += '\n';
+		}
+		return out;
+	}
+
+	/// @brief	Gets the configurations that the equivalence tests are run with.
+	std::vector<ini::cParserConfig> configs()
+	{
+		std::vector<ini::cParserConfig> out;
+		for (int mode{ 0 }; mode < 32; ++mode) {
+			ini::cParserConfig config;
+			config.stripWhitespaceFromHeaders = mode & 1;
+			config.stripEnclosingQuotes = !(mode & 2);
+			config.stripWhitespaceFromValue = !(mode & 4);
+			if (mode & 8)
+				config.escapeChars = "\\ =;";
+			config.overrideStyle = (mode & 2) ? ini::OverrideStyle::OnlyBlank : ini::OverrideStyle::Override;
+			config.syntaxErrorStyle = (mode & 16) ? ini::SyntaxErrorStyle::Throw : ini::SyntaxErrorStyle::Ignore;
+			out.emplace_back(config);
+		}
+		return out;
+	}
+
+	/// @brief	An event handler for parse_events() that records every event as a line of text.
+	struct event_recorder {
+		std::vector<std::string> events;
+		/// @brief	The number of key-value events to accept before stopping the parser; unlimited by default.
+		size_t stopAfter{ static_cast<size_t>(-1) };
+
+		void on_header(std::string_view header, size_t ln)
+		{
+			events.emplace_back("H " + std::string{ header } + " @" + std::to_string(ln));
+		}
+		bool on_key_value(std::string_view header, std::string_view key, std::string_view value, size_t ln)
+		{
+			events.emplace_back("KV " + std::string{ header } + '.' + std::string{ key } + '=' + std::string{ value } + " @" + std::to_string(ln));
+			return --stopAfter != 0;
+		}
+		void on_error(ini::ini_parse_error const& error)
+		{
+			events.emplace_back(std::string{ error.type == ini::ParseErrorType::Syntax ? "SYNTAX" : "MASK" } + " @" + std::to_string(error.line));
+		}
+	};
+
+	/// @returns	The parsed & sorted contents of data, or the exception message prefixed with "EX ".
+	template<class F>
+	std::variant<sorted_ini, std::string> attempt(F&& parse)
+	{
+		try {
+			return sorted(parse());
+		} catch (std::exception const& ex) {
+			return std::string{ "EX " } + ex.what();
+		}
+	}
+}
+
+TEST(ini_parse, ParsesHeadersKeysAndValues)
+{
+	const std::string data{ "gk = 1\n[Sec One] ; comment\nKey = \"  quoted # not comment \" \nother=  val  \n  \n[two]\na=b\nA=c\n" };
+	const auto& ini{ ini::parse<ini::CaseSensitiveCompare>(std::string_view{ data }) };
+
+	EXPECT_EQ(ini.at("").at("gk"), "1");
+	EXPECT_EQ(ini.at("Sec One").at("Key"), "  quoted # not comment ");
+	EXPECT_EQ(ini.at("Sec One").at("other"), "val");
+	EXPECT_EQ(ini.at("two").at("a"), "b");
+	EXPECT_EQ(ini.at("two").at("A"), "c");
+}
+
+TEST(ini_parse, ThrowsOnDuplicateKeys)
+{
+	ini::cParserConfig config;
+	config.overrideStyle = ini::OverrideStyle::Throw;
+	EXPECT_THROW(ini::parse<ini::CaseSensitiveCompare>(std::string_view{ "[x]\na=1\na=2\n" }, config), ini::ini_key_exception);
+}
+
+TEST(ini_parse, ParseViewReferencesTheBuffer)
+{
+	const std::string data{ "[s]\nkey = value\n" };
+	const auto& view{ ini::parse_view<ini::CaseSensitiveCompare>(std::string_view{ data }) };
+	const auto& value{ view.at("s").at("key") };
+
+	EXPECT_EQ(value, "value");
+	EXPECT_GE(value.data(), data.data());
+	EXPECT_LE(value.data() + value.size(), data.data() + data.size());
+}
+
+// parse(std::istream&), parse(std::string_view) & materialize(parse_view()) must produce the same result for any input
+TEST(ini_parse, ParseModesAreEquivalent)
+{
+	std::mt19937 rng{ 307 };
+	for (int i{ 0 }; i < 400; ++i) {
+		const auto& data{ random_ini(rng) };
+		for (const auto& config : configs()) {
+			const auto& fromBuffer{ attempt([&] { return ini::parse<ini::CaseSensitiveCompare>(std::string_view{ data }, config); }) };
+			const auto& fromStream{ attempt([&] { std::istringstream is{ data }; return ini::parse<ini::CaseSensitiveCompare>(is, config); }) };
+			const auto& fromView{ attempt([&] { return ini::materialize<ini::CaseSensitiveCompare>(ini::parse_view<ini::CaseSensitiveCompare>(std::string_view{ data }, config)); }) };
+
+			ASSERT_EQ(fromBuffer, fromStream) << "input:\n" << data;
+			ASSERT_EQ(fromBuffer, fromView) << "input:\n" << data;
+		}
+	}
+}
+
+// the tokenizer must produce the same results, including exceptions, as the original line-by-line parser
+TEST(ini_parse, MatchesReferenceParser)
+{
+	std::mt19937 rng{ 7 };
+	for (int i{ 0 }; i < 400; ++i) {
+		const auto& data{ random_ini(rng) };
+		for (const auto& config : configs()) {
+			const auto& expected{ attempt([&] { std::istringstream is{ data }; return ini_reference::parse<ini::CaseSensitiveCompare>(is, config); }) };
+			const auto& actual{ attempt([&] { return ini::parse<ini::CaseSensitiveCompare>(std::string_view{ data }, config); }) };
+
+			ASSERT_EQ(expected, actual) << "input:\n" << data;
+		}
+	}
+}
+
+// the pre-sized printer must produce exactly the same output as the original stream printer
+TEST(ini_print, MatchesReferencePrinter)
+{
+	std::mt19937 rng{ 11 };
+	for (int i{ 0 }; i < 200; ++i) {
+		const auto& container{ ini::parse<ini::CaseSensitiveCompare>(std::string_view{ random_ini(rng) }) };
+		for (int mode{ 0 }; mode < 4; ++mode) {
+			ini::cPrinter printer{ &container };
+			printer.explicitGlobalHeader = mode & 1;
+			printer.insertNewlineBetweenSections = mode & 2;
+
+			std::ostringstream expected, actual;
+			ini_reference::print(expected, container, printer.explicitGlobalHeader, printer.insertNewlineBetweenSections);
+			actual << printer;
+
+			ASSERT_EQ(expected.str(), actual.str());
+			ASSERT_EQ(expected.str(), printer.str());
+		}
+	}
+}
+
+TEST(ini_parse, ParsesFilesWithAndWithoutMapping)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_ini_parse_file.ini" };
+	const auto& missing{ std::filesystem::temp_directory_path() / "307lib_ini_parse_file_missing.ini" };
+	std::ofstream(path, std::ios::binary) << "[s]\nkey = value\n";
+
+	EXPECT_EQ(ini::parse_file(path).at("s").at("key"), "value");
+	EXPECT_EQ(sorted(ini::parse_file(path)), sorted(ini::parse_file(path, {}, true)));
+	EXPECT_TRUE(ini::parse_file(missing).empty());
+	EXPECT_TRUE(ini::parse_file(missing, {}, true).empty());
+	EXPECT_EQ(ini::INI(path).at("s", "key"), "value");
+	EXPECT_THROW(ini::INI(missing, {}, true), ini::ini_file_not_found_exception);
+
+	std::filesystem::remove(path);
+}
+
+TEST(ini_parse_events, CallsTheHandlerInOrder)
+{
+	const std::string data{ "g = 0\n[a]\nx = 1\n; comment\n\ny = \"2\"\n[b]\nz=3\n" };
+	event_recorder recorder;
+	ini::parse_events<ini::CaseSensitiveCompare>(std::string_view{ data }, recorder);
+
+	EXPECT_EQ(recorder.events, (std::vector<std::string>{ "KV .g=0 @0", "H a @1", "KV a.x=1 @2", "KV a.y=2 @5", "H b @6", "KV b.z=3 @7" }));
+}
+
+TEST(ini_parse_events, StopsWhenAHandlerReturnsFalse)
+{
+	const std::string data{ "[a]\nx = 1\ny = 2\n[b]\nz = 3\n" };
+	event_recorder recorder;
+	recorder.stopAfter = 2;
+	ini::parse_events<ini::CaseSensitiveCompare>(std::string_view{ data }, recorder);
+	EXPECT_EQ(recorder.events, (std::vector<std::string>{ "H a @0", "KV a.x=1 @1", "KV a.y=2 @2" }));
+
+	// returning false from on_header skips that section, but not the following ones
+	struct skip_a {
+		std::vector<std::string> keys;
+		bool on_header(std::string_view header, size_t) { return header != "a"; }
+		void on_key_value(std::string_view, std::string_view key, std::string_view, size_t) { keys.emplace_back(key); }
+	} skipper;
+	ini::parse_events<ini::CaseSensitiveCompare>(std::string_view{ data }, skipper);
+	EXPECT_EQ(skipper.keys, std::vector<std::string>{ "z" });
+
+	// returning false from on_error stops the parser at the first error
+	struct stop_on_error {
+		std::vector<size_t> lines;
+		bool on_error(ini::ini_parse_error const& error) { lines.push_back(error.line); return false; }
+		void on_key_value(std::string_view, std::string_view, std::string_view, size_t ln) { lines.push_back(ln); }
+	} stopper;
+	ini::cParserConfig config;
+	config.syntaxErrorStyle = ini::SyntaxErrorStyle::Throw;
+	ini::parse_events(std::string_view{ "a = 1\n= 2\nb = 3\n= 4\n" }, stopper, config);
+	EXPECT_EQ(stopper.lines, (std::vector<size_t>{ 0, 1 }));
+}
+
+TEST(ini_parse_events, ReportsErrorsWithTheirLineNumbers)
+{
+	const std::string data{ "[a]\nx = 1\n= no key\nx [b] y\nz = 2\n[c]\nw = \"quoted\" after\nv = 3\n" };
+	ini::cParserConfig config;
+	config.syntaxErrorStyle = ini::SyntaxErrorStyle::Throw;
+
+	event_recorder recorder;
+	ini::parse_events(std::string_view{ data }, recorder, config);
+	// the keys in the section of an invalid header are skipped
+	EXPECT_EQ(recorder.events, (std::vector<std::string>{ "H a @0", "KV a.x=1 @1", "SYNTAX @2", "SYNTAX @3", "H c @5", "SYNTAX @6", "KV c.v=3 @7" }));
+
+	// without an on_error method, the same error is thrown instead
+	struct no_errors { void on_key_value(std::string_view, std::string_view, std::string_view, size_t) {} } handler;
+	EXPECT_THROW(ini::parse_events(std::string_view{ data }, handler, config), ini::ini_syntax_exception);
+
+	ini::cParserConfig masked;
+	masked.maskStyle = ini::MaskStyle::Throw;
+	masked.mask["a"]["x"];
+	event_recorder maskRecorder;
+	ini::parse_events(std::string_view{ "[a]\nx = 1\ny = 2\n[b]\n" }, maskRecorder, masked);
+	EXPECT_EQ(maskRecorder.events, (std::vector<std::string>{ "H a @0", "KV a.x=1 @1", "MASK @2", "MASK @3" }));
+}
+
+// the stream overload reads one line at a time, but must report exactly the same events as the buffer overload
+TEST(ini_parse_events, StreamAndBufferOverloadsAreEquivalent)
+{
+	std::mt19937 rng{ 13 };
+	for (int i{ 0 }; i < 400; ++i) {
+		const auto& data{ random_ini(rng) };
+		for (const auto& config : configs()) {
+			event_recorder fromBuffer, fromStream;
+			ini::parse_events(std::string_view{ data }, fromBuffer, config);
+			std::istringstream is{ data };
+			ini::parse_events(is, fromStream, config);
+
+			ASSERT_EQ(fromBuffer.events, fromStream.events) << "input:\n" << data;
+		}
+	}
+}
+
+// collecting the events into a container must give the same result, including exceptions, as parse()
+TEST(ini_parse_events, MatchesParse)
+{
+	std::mt19937 rng{ 17 };
+	for (int i{ 0 }; i < 400; ++i) {
+		const auto& data{ random_ini(rng) };
+		for (auto config : configs()) {
+			// events report duplicate keys as they appear, which is what OverrideStyle::Override keeps
+			// parse() doesn't add sections that have no keys, so only the keys are collected
+			config.overrideStyle = ini::OverrideStyle::Override;
+
+			const auto& expected{ attempt([&] { return ini::parse<ini::CaseSensitiveCompare>(std::string_view{ data }, config); }) };
+			const auto& actual{ attempt([&] {
+				sorted_ini out;
+				struct collector {
+					sorted_ini& out;
+					void on_key_value(std::string_view header, std::string_view key, std::string_view value, size_t) { out[std::string{ header }][std::string{ key }] = value; }
+				} handler{ out };
+				ini::parse_events(std::string_view{ data }, handler, config);
+				return out;
+			}) };
+
+			ASSERT_EQ(expected, actual) << "input:\n" << data;
+		}
+	}
+}
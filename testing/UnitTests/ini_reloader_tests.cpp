@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <simpleINI.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+	/// @brief	Creates a temporary directory for a test's INI files, and removes it afterwards.
+	struct temp_files {
+		std::filesystem::path dir;
+		int writes{ 0 };
+
+		temp_files() : dir{ std::filesystem::temp_directory_path() / ("307lib_reloader_" + std::string{ ::testing::UnitTest::GetInstance()->current_test_info()->name() }) }
+		{
+			std::filesystem::create_directories(dir);
+		}
+		~temp_files()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(dir, ec);
+		}
+
+		std::filesystem::path path(std::string const& name) const { return dir / name; }
+
+		/// @brief	Writes a file, and gives it a unique last write time so that the change is detected even on filesystems with a coarse timestamp resolution.
+		void write(std::string const& name, std::string const& content)
+		{
+			std::ofstream(path(name), std::ios::binary | std::ios::trunc) << content;
+			std::filesystem::last_write_time(path(name), std::filesystem::file_time_type::clock::now() + std::chrono::seconds{ ++writes });
+		}
+	};
+}
+
+TEST(ini_reloader, MergesLayersAndReportsChanges)
+{
+	temp_files files;
+	files.write("base.ini", "[s]\na = 1\nb = 2\n");
+	files.write("user.ini", "[s]\nb = 3\n");
+
+	ini::INIReloader reloader{ { files.path("base.ini"), files.path("user.ini"), files.path("missing.ini") } };
+	EXPECT_EQ(reloader->at("s", "a"), "1");
+	EXPECT_EQ(reloader->at("s", "b"), "3");
+	EXPECT_FALSE(reloader.is_modified());
+
+	std::vector<std::string> notified;
+	reloader.subscribe("S", "A", [&notified](ini::ini_change const& change) { notified.push_back(change.newValue); });
+
+	files.write("base.ini", "[s]\na = 4\nb = 2\n");
+	files.write("missing.ini", "[s]\nc = 5\n");
+	EXPECT_TRUE(reloader.is_modified());
+
+	const auto& changes{ reloader.reload() };
+	EXPECT_EQ(changes.size(), 2u);
+	EXPECT_EQ(reloader->at("s", "a"), "4");
+	EXPECT_EQ(reloader->at("s", "c"), "5");
+	EXPECT_EQ(notified, std::vector<std::string>{ "4" });
+	EXPECT_TRUE(reloader.reload().empty());
+}
+
+// when a later layer fails to parse, the changes to earlier layers must not be lost
+TEST(ini_reloader, ReloadIsAllOrNothingWhenParsingFails)
+{
+	temp_files files;
+	files.write("a.ini", "[s]\nx = 1\n");
+	files.write("b.ini", "[s]\ny = 1\n");
+
+	ini::ParserConfig config;
+	config.syntaxErrorStyle = ini::SyntaxErrorStyle::Throw;
+	ini::INIReloader reloader{ { files.path("a.ini"), files.path("b.ini") }, config };
+
+	files.write("a.ini", "[s]\nx = 2\n");
+	files.write("b.ini", "[s]\n= no key\n");
+	EXPECT_THROW(reloader.reload(), ini::ini_syntax_exception);
+	EXPECT_EQ(reloader->at("s", "x"), "1");
+	EXPECT_TRUE(reloader.is_modified());
+
+	files.write("b.ini", "[s]\ny = 2\n");
+	const auto& changes{ reloader.reload() };
+	EXPECT_EQ(changes.size(), 2u);
+	EXPECT_EQ(reloader->at("s", "x"), "2");
+	EXPECT_EQ(reloader->at("s", "y"), "2");
+}
+
+// when merging the layers fails, none of the layers may be updated
+TEST(ini_reloader, ReloadIsAllOrNothingWhenMergingFails)
+{
+	temp_files files;
+	files.write("a.ini", "[s]\nx = 1\nw = 1\n");
+	files.write("b.ini", "[s]\ny = 1\n");
+
+	ini::INIReloader reloader{ { files.path("a.ini"), files.path("b.ini") }, {}, ini::OverrideStyle::Throw };
+
+	files.write("a.ini", "[s]\nx = 2\nw = 2\n");
+	files.write("b.ini", "[s]\ny = 1\nx = 3\n");
+	EXPECT_THROW(reloader.reload(), ini::ini_key_exception);
+	EXPECT_EQ(reloader->at("s", "x"), "1");
+	EXPECT_EQ(reloader->at("s", "w"), "1");
+
+	// w is only changed by a.ini, so it's lost if a.ini was marked as loaded by the failed reload
+	files.write("b.ini", "[s]\ny = 1\n");
+	const auto& changes{ reloader.reload() };
+	EXPECT_EQ(changes.size(), 2u);
+	EXPECT_EQ(reloader->at("s", "x"), "2");
+	EXPECT_EQ(reloader->at("s", "w"), "2");
+}
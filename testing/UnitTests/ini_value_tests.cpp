@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <simpleINI.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+TEST(ini_value, ConvertsNumbers)
+{
+	const ini::ini_value i{ "42" }, f{ "2.5" }, b{ "YES" };
+
+	EXPECT_EQ(i.as<int>().value(), 42);
+	EXPECT_EQ(i.as<int>(16).value(), 0x42);
+	EXPECT_EQ(static_cast<int>(i), 42);
+	EXPECT_EQ(i.cast<int>(), 42);
+	EXPECT_DOUBLE_EQ(f.as<double>().value(), 2.5);
+	EXPECT_FLOAT_EQ(f.as<float>().value(), 2.5f);
+	EXPECT_DOUBLE_EQ(static_cast<double>(f), 2.5);
+	EXPECT_TRUE(b.as<bool>().value());
+	EXPECT_TRUE(static_cast<bool>(b));
+}
+
+// like str::tonumber, only the number at the beginning of the value is converted
+TEST(ini_value, ConvertsNumericPrefixes)
+{
+	const ini::ini_value i{ "42abc" }, f{ "1.5 seconds" }, none{ "abc" };
+
+	EXPECT_EQ(i.as<int>().value(), 42);
+	EXPECT_EQ(static_cast<int>(i), 42);
+	EXPECT_EQ(i.cast<long>(), 42);
+	EXPECT_DOUBLE_EQ(f.as<double>().value(), 1.5);
+	EXPECT_DOUBLE_EQ(static_cast<double>(f), 1.5);
+
+	EXPECT_FALSE(none.as<int>().has_value());
+	EXPECT_EQ(static_cast<int>(none), 0);
+	EXPECT_THROW(none.cast<int>(), ini::ini_cast_exception);
+}
+
+TEST(ini_value, FloatingPointAsAcceptsABase)
+{
+	const ini::ini_value f{ "1.8" }, hex{ "1.8p1" };
+
+	EXPECT_DOUBLE_EQ(f.as<double>(10).value(), 1.8);
+	EXPECT_DOUBLE_EQ(hex.as<double>(16).value(), 3.0);
+}
+
+TEST(ini_value, RejectsOutOfRangeNumbers)
+{
+	const ini::ini_value big{ "300" };
+
+	EXPECT_FALSE(big.as<int8_t>().has_value());
+	EXPECT_EQ(big.as<int>().value(), 300);
+	EXPECT_FALSE(big.as<int8_t>().has_value());
+}
+
+TEST(ini_value, ConversionCacheIsOptIn)
+{
+	ini::ini_value v{ "7" };
+	EXPECT_FALSE(v.has_conversion_cache());
+	EXPECT_EQ(v.as<int>().value(), 7);
+	EXPECT_FALSE(v.has_conversion_cache());
+
+	v.enable_conversion_cache();
+	EXPECT_TRUE(v.has_conversion_cache());
+	EXPECT_EQ(v.as<int>().value(), 7);
+	// reading the value as a string doesn't affect the cache
+	EXPECT_EQ(static_cast<std::string const&>(v), "7");
+	EXPECT_EQ(std::string_view{ v }, "7");
+	EXPECT_TRUE(v.has_conversion_cache());
+
+	const ini::ini_value copy{ v };
+	EXPECT_TRUE(copy.has_conversion_cache());
+	ini::ini_value assigned;
+	assigned = v;
+	EXPECT_TRUE(assigned.has_conversion_cache());
+	EXPECT_EQ(assigned.as<int>().value(), 7);
+
+	v.disable_conversion_cache();
+	EXPECT_FALSE(v.has_conversion_cache());
+	EXPECT_EQ(v.as<int>().value(), 7);
+}
+
+// writes through a mutable reference, pointer or iterator can't be detected, so handing one out drops the cache
+TEST(ini_value, MutableAccessDisablesTheCache)
+{
+	ini::ini_value v{ "12" };
+	v.enable_conversion_cache();
+	EXPECT_EQ(v.as<int>().value(), 12);
+
+	char& first{ v[0] };
+	EXPECT_FALSE(v.has_conversion_cache());
+	first = '3';
+	EXPECT_EQ(v.as<int>().value(), 32);
+
+	v.enable_conversion_cache();
+	EXPECT_EQ(v.as<int>().value(), 32);
+	*v.begin() = '4';
+	EXPECT_EQ(v.as<int>().value(), 42);
+	v.enable_conversion_cache();
+	EXPECT_EQ(v.as<int>().value(), 42);
+	v.data()[1] = '5';
+	EXPECT_EQ(v.as<int>().value(), 45);
+}
+
+// the cached conversion must be discarded whenever the value changes
+TEST(ini_value, ModifyingTheValueResetsTheCache)
+{
+	ini::ini_value v{ "7" };
+	v.enable_conversion_cache();
+	EXPECT_EQ(v.as<int>().value(), 7);
+	v.append("1");
+	EXPECT_EQ(v.as<int>().value(), 71);
+	v = 5;
+	EXPECT_EQ(v.as<int>().value(), 5);
+
+	EXPECT_TRUE(v.has_conversion_cache());
+
+	const ini::ini_value copy{ v };
+	EXPECT_EQ(copy.as<long>().value(), 5);
+}
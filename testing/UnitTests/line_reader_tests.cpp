@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <line_reader.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+	/// @returns	The lines that line_reader yields for the given data & chunk size.
+	std::vector<std::string> read_lines(std::string const& data, size_t const chunkSize)
+	{
+		std::istringstream is{ data };
+		file::line_reader reader{ is, chunkSize };
+		std::vector<std::string> lines;
+		for (const std::string_view line : reader)
+			lines.emplace_back(line);
+		EXPECT_EQ(reader.line_number(), lines.size());
+		return lines;
+	}
+	/// @returns	The lines that std::getline yields for the given data.
+	std::vector<std::string> getline_lines(std::string const& data)
+	{
+		std::istringstream is{ data };
+		std::vector<std::string> lines;
+		for (std::string line; std::getline(is, line); )
+			lines.emplace_back(std::move(line));
+		return lines;
+	}
+}
+
+TEST(line_reader, SplitsLinesAcrossChunkBoundaries)
+{
+	// with a chunk size of 4, most of these lines start in one chunk and end in the next
+	EXPECT_EQ(read_lines("abc\ndefgh\nij\n\nklm\n", 4), (std::vector<std::string>{ "abc", "defgh", "ij", "", "klm" }));
+}
+
+TEST(line_reader, GrowsTheBufferForLinesLongerThanTheChunk)
+{
+	const std::string longLine(10000, 'x');
+	EXPECT_EQ(read_lines("a\n" + longLine + "\nb\n", 16), (std::vector<std::string>{ "a", longLine, "b" }));
+}
+
+TEST(line_reader, YieldsTheLastLineWithoutANewline)
+{
+	EXPECT_EQ(read_lines("a\nb", 3), (std::vector<std::string>{ "a", "b" }));
+	EXPECT_EQ(read_lines("only", 2), std::vector<std::string>{ "only" });
+}
+
+// carriage returns are kept, the same as std::getline
+TEST(line_reader, KeepsCarriageReturns)
+{
+	EXPECT_EQ(read_lines("a\r\nb\r\n\r\n", 3), (std::vector<std::string>{ "a\r", "b\r", "\r" }));
+}
+
+TEST(line_reader, YieldsNothingForEmptyInput)
+{
+	EXPECT_TRUE(read_lines("", 8).empty());
+
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_line_reader_empty.txt" };
+	std::ofstream{ path };
+	file::line_reader reader{ path };
+	EXPECT_TRUE(reader.is_open());
+	EXPECT_EQ(reader.begin(), reader.end());
+	std::filesystem::remove(path);
+
+	file::line_reader missing{ std::filesystem::temp_directory_path() / "307lib_line_reader_missing.txt" };
+	EXPECT_FALSE(missing.is_open());
+	EXPECT_EQ(missing.begin(), missing.end());
+}
+
+// every chunk size, down to 1 byte at a time, must give the same lines as std::getline
+TEST(line_reader, MatchesGetlineForAnyChunkSize)
+{
+	std::mt19937 rng{ 5 };
+	for (int i{ 0 }; i < 200; ++i) {
+		std::string data;
+		for (size_t n{ rng() % 200 }; n > 0; --n)
+			data += "ab\r\n"[rng() % 4];
+		const auto& expected{ getline_lines(data) };
+		for (const size_t chunkSize : { 1, 2, 3, 7, 64, 1024 })
+			ASSERT_EQ(read_lines(data, chunkSize), expected) << "chunk size " << chunkSize << ", input: " << data;
+	}
+}
+
+TEST(line_reader, ReadsFiles)
+{
+	const auto& path{ std::filesystem::temp_directory_path() / "307lib_line_reader_file.txt" };
+	std::ofstream(path, std::ios::binary) << "first\nsecond\r\nthird";
+	std::vector<std::string> lines;
+	for (const std::string_view line : file::line_reader{ path, 1 })
+		lines.emplace_back(line);
+	EXPECT_EQ(lines, (std::vector<std::string>{ "first", "second\r", "third" }));
+	std::filesystem::remove(path);
+}
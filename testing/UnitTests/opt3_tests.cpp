@@ -0,0 +1,300 @@
+#include <gtest/gtest.h>
+
+#include <opt3.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	/// @brief	Describes each argument in a parse result, or the exception that the parser threw, so results of different parsers can be compared.
+	template<class TContainer>
+	std::string describe(std::function<TContainer()> const& parse)
+	{
+		std::ostringstream ss;
+		try {
+			for (const auto& arg : parse()) {
+				ss << arg.index() << ':' << arg.name();
+				if (const auto& value{ arg.getValue() }; value.has_value())
+					ss << '=' << *value;
+				ss << ' ';
+			}
+		} catch (std::exception const& ex) {
+			ss << "threw " << ex.what();
+		}
+		return ss.str();
+	}
+
+	opt3::capture_list make_captures()
+	{
+		return{
+			opt3::make_template(opt3::CaptureStyle::Optional, 'a', "opt"),
+			opt3::make_template(opt3::CaptureStyle::Required, 'r', "req"),
+			opt3::make_template(opt3::CaptureStyle::Disabled, 'q', "no"),
+			opt3::make_template(opt3::CaptureStyle::EqualsOnly | opt3::CaptureStyle::Optional, 'e', "eq"),
+			opt3::make_template('b').SetMax(2),
+			opt3::make_template(opt3::ConflictStyle::Conflict, 'c').SetConflicts("opt"),
+		};
+	}
+
+	/// @brief	The compile-time equivalent of make_captures().
+	constexpr auto schema{ opt3::make_schema(
+		opt3::schema_group{ "a", "opt" },
+		opt3::schema_group{ "r", "req" }.SetCaptureStyle(opt3::CaptureStyle::Required),
+		opt3::schema_group{ "q", "no" }.SetCaptureStyle(opt3::CaptureStyle::Disabled),
+		opt3::schema_group{ "e", "eq" }.SetCaptureStyle(opt3::CaptureStyle::EqualsOnly | opt3::CaptureStyle::Optional),
+		opt3::schema_group{ "b" }.SetMax(2),
+		opt3::schema_group{ "c" }.SetConflicts("opt")
+	) };
+
+	/// @brief	Generates short argument lists from fragments that exercise flag chains, captures, '=' delimiters & the end-of-args specifier.
+	struct arg_generator {
+		std::mt19937 rng{ 42 };
+
+		size_t next(size_t const n) { return rng() % n; }
+
+		std::vector<std::string> args()
+		{
+			static constexpr const char* pieces[]{ "a", "b", "c", "r", "q", "x", "opt", "req", "no", "eq", "=", "v", "1", "-", "--" };
+			std::vector<std::string> out;
+			for (size_t n{ next(7) }; n > 0; --n) {
+				std::string arg{ next(4) == 0 ? "-" : next(3) == 0 ? "--" : "" };
+				for (size_t k{ next(4) }; k > 0; --k)
+					arg += pieces[next(std::size(pieces))];
+				out.emplace_back(std::move(arg));
+			}
+			return out;
+		}
+		opt3::ArgParsingRules rules()
+		{
+			opt3::ArgParsingRules out;
+			out.allowUnexpectedCaptureArgs = next(2);
+			out.convertUnexpectedCaptureArgsToParameters = next(2);
+			out.includeEndOfArgsSpecifierInOutput = next(2);
+			return out;
+		}
+	};
+}
+
+TEST(opt3, ParseViewMatchesParse)
+{
+	const std::vector<std::string> args{ "-ab", "--opt=1", "param", "-r", "captured", "--no", "x", "-e=2", "--", "-a" };
+	const auto& captures{ make_captures() };
+
+	const auto& owning{ opt3::parse(std::vector<std::string>{ args }, captures, {}) };
+	const auto& view{ opt3::parse_view(args, captures) };
+	ASSERT_EQ(owning.size(), view.size());
+	EXPECT_EQ(describe<opt3::arg_container>([&] { return owning; }), describe<opt3::arg_view_container>([&] { return view; }));
+	EXPECT_EQ(view[0].name(), "a");
+	EXPECT_EQ(view[2].getValue(), std::optional<std::string_view>{ "1" });
+}
+
+// parse() & parse_view() share a tokenizer, but collect & validate the results separately; both must agree on every input
+TEST(opt3, ParseViewMatchesParseForGeneratedArguments)
+{
+	arg_generator gen;
+	const auto& captures{ make_captures() };
+	for (int i{ 0 }; i < 5000; ++i) {
+		const auto& args{ gen.args() };
+		const auto& rules{ gen.rules() };
+		ASSERT_EQ(describe<opt3::arg_container>([&] { return opt3::parse(std::vector<std::string>{ args }, captures, rules); }),
+				  describe<opt3::arg_view_container>([&] { return opt3::parse_view(args, captures, rules); }))
+			<< "iteration " << i;
+	}
+}
+
+// a schema is validated with precomputed tables instead of the capture list's groups; both must accept, reject & capture the same arguments
+//  when the capture list's groups are counted the same way as a schema's
+TEST(opt3, SchemaMatchesCaptureListForGeneratedArguments)
+{
+	arg_generator gen;
+	const auto& captures{ make_captures() };
+	for (int i{ 0 }; i < 5000; ++i) {
+		const auto& args{ gen.args() };
+		auto rules{ gen.rules() };
+		rules.strictGroupCounts = true;
+		const auto& expected{ describe<opt3::arg_container>([&] { return opt3::parse(std::vector<std::string>{ args }, captures, rules); }) };
+		ASSERT_EQ(expected, describe<opt3::arg_container>([&] { return opt3::parse(std::vector<std::string>{ args }, schema, rules); })) << "iteration " << i;
+		ASSERT_EQ(expected, describe<opt3::arg_view_container>([&] { return opt3::parse_view(args, schema, rules); })) << "iteration " << i;
+	}
+}
+
+// groups added after indexing are found by the fallback scan, but the counter's rules don't cover them
+TEST(opt3, CountingArgumentsRequiresAnUpToDateIndex)
+{
+	auto captures{ make_captures() };
+	captures.emplace_back(opt3::make_template(opt3::CaptureStyle::Optional, 'z').SetMax(1));
+	const auto& stale{ captures.lookup('z') };
+	ASSERT_EQ(stale.group, captures.size() - 1);
+
+	EXPECT_THROW(captures.make_counter(), ex::except);
+
+	// parse() indexes a copy of an out-of-date list, so the new group is counted & validated
+	EXPECT_EQ(opt3::parse({ "-z" }, captures, {}).size(), 1u);
+	EXPECT_THROW(opt3::parse({ "-z", "-z" }, captures, {}), ex::except);
+
+	captures.reindex();
+	auto counter{ captures.make_counter() };
+	counter.add(captures.size() + 10, false); //< out of range groups are ignored instead of written out of bounds
+	counter.add(stale.group, false);
+	EXPECT_NO_THROW(captures.validate(counter));
+	counter.add(stale.group, false);
+	EXPECT_THROW(captures.validate(counter), ex::except);
+}
+
+// replacing a group doesn't change the size of the list, but must still make the index out-of-date
+TEST(opt3, ReplacingAGroupMakesTheIndexOutOfDate)
+{
+	auto captures{ make_captures() };
+	ASSERT_TRUE(captures.is_indexed());
+	EXPECT_EQ(std::as_const(captures)[0].templates.size(), 2u);
+	EXPECT_TRUE(captures.is_indexed()); //< const access doesn't count
+
+	captures[0] = opt3::make_template(opt3::CaptureStyle::Required, 'y');
+	EXPECT_FALSE(captures.is_indexed());
+	EXPECT_EQ(captures.lookup('y').group, 0u);
+	EXPECT_FALSE(captures.is_present("opt"));
+
+	const auto& stale{ opt3::parse({ "-y", "v", "--opt", "w" }, captures, {}) };
+	EXPECT_EQ(describe<opt3::arg_container>([&] { return stale; }), "1:y=v 2:opt 0:w ");
+	EXPECT_FALSE(captures.is_indexed()); //< parse() indexes a copy, not the caller's list
+
+	captures.reindex();
+	EXPECT_TRUE(captures.is_indexed());
+	const std::vector<std::string> args{ "-y", "v" };
+	EXPECT_EQ(describe<opt3::arg_view_container>([&] { return opt3::parse_view(args, captures); }), "1:y=v ");
+}
+
+TEST(opt3, IndexedQueries)
+{
+	const auto& args{ opt3::parse({ "-ab", "--opt=1", "param", "-a" }, make_captures(), {}) };
+	ASSERT_TRUE(args.is_indexed());
+	ASSERT_EQ(describe<opt3::arg_container>([&] { return args; }), "1:a 1:b 2:opt=1 0:param 1:a ");
+
+	using positions = std::vector<size_t>;
+	const auto& to_vector{ [](std::span<const size_t> const& span) { return positions{ span.begin(), span.end() }; } };
+	EXPECT_EQ(to_vector(args.positions_of('a')), (positions{ 0, 4 }));
+	EXPECT_EQ(to_vector(args.positions_of("opt")), positions{ 2 });
+	EXPECT_TRUE(args.positions_of("missing").empty());
+	EXPECT_EQ(to_vector(args.positions_of<opt3::Flag>()), (positions{ 0, 1, 4 }));
+	EXPECT_EQ(to_vector(args.positions_of<opt3::Option>()), positions{ 2 });
+	EXPECT_EQ(to_vector(args.positions_of<opt3::Parameter>()), positions{ 3 });
+
+	EXPECT_EQ(args.count('a'), 2u);
+	EXPECT_EQ(args.count('a', "opt"), 3u);
+	EXPECT_EQ(args.count<opt3::Flag>(), 3u);
+	EXPECT_EQ(args.count<opt3::Option>('a'), 0u);
+	EXPECT_EQ(args.find('a') - args.begin(), 0);
+	EXPECT_EQ(args.rfind('a').base() - args.begin(), 5); //< one past the last match
+	EXPECT_EQ(args.getv("opt"), "1");
+
+	const auto& span{ args.subspan(1, 2) };
+	ASSERT_EQ(span.size(), 2u);
+	EXPECT_EQ(span[0].name(), "b");
+	EXPECT_EQ(span[1].name(), "opt");
+}
+
+// every query must give the same results with & without the index
+TEST(opt3, IndexedQueriesMatchUnindexedQueries)
+{
+	arg_generator gen;
+	const auto& captures{ make_captures() };
+	for (int i{ 0 }; i < 2000; ++i) {
+		opt3::arg_container indexed;
+		try {
+			indexed = opt3::parse(gen.args(), captures, gen.rules());
+		} catch (...) {
+			continue;
+		}
+		const auto& unindexed{ opt3::arg_container{ indexed.cbegin(), indexed.cend() } };
+		ASSERT_TRUE(indexed.is_indexed());
+		ASSERT_FALSE(unindexed.is_indexed());
+
+		for (const auto* name : { "a", "b", "c", "r", "opt", "req", "x", "v", "missing" }) {
+			ASSERT_EQ(std::as_const(indexed).count(name), unindexed.count(name)) << "iteration " << i << ", " << name;
+			ASSERT_EQ(std::as_const(indexed).count<opt3::Flag>(name), unindexed.count<opt3::Flag>(name)) << "iteration " << i << ", " << name;
+			ASSERT_EQ(std::as_const(indexed).find(name) - indexed.cbegin(), unindexed.find(name) - unindexed.cbegin()) << "iteration " << i << ", " << name;
+			ASSERT_EQ(std::as_const(indexed).rfind(name) - indexed.crbegin(), unindexed.rfind(name) - unindexed.crbegin()) << "iteration " << i << ", " << name;
+			ASSERT_EQ(std::as_const(indexed).getv_all(name, "opt"), unindexed.getv_all(name, "opt")) << "iteration " << i << ", " << name;
+		}
+		ASSERT_TRUE(indexed.is_indexed());
+	}
+}
+
+// the index must not be used after the arguments were changed in place, even though the size stays the same
+TEST(opt3, ModifyingArgumentsMakesTheIndexOutOfDate)
+{
+	auto args{ opt3::parse({ "-ab", "--opt=1", "param", "-a" }, make_captures(), {}) };
+	for (const auto& arg : std::as_const(args))
+		(void)arg;
+	EXPECT_TRUE(args.is_indexed()); //< const access doesn't count
+
+	args[0] = opt3::make_argument<opt3::Flag>('z');
+	EXPECT_FALSE(args.is_indexed());
+	EXPECT_THROW((void)args.positions_of('z'), ex::except);
+	EXPECT_EQ(std::as_const(args).count('z'), 1u);
+	EXPECT_EQ(std::as_const(args).count('a'), 1u);
+	EXPECT_EQ(std::as_const(args).find('z'), args.cbegin());
+
+	args.build_index();
+	EXPECT_EQ(args.positions_of('z').size(), 1u);
+	EXPECT_EQ(args.positions_of('a').front(), 4u);
+
+	std::sort(args.begin(), args.end(), [](auto const& l, auto const& r) { return l.name() < r.name(); });
+	EXPECT_FALSE(args.is_indexed());
+	EXPECT_EQ(std::as_const(args).find('a') - args.cbegin(), 0);
+	EXPECT_EQ(std::as_const(args).find('z') - args.cbegin(), 4);
+	EXPECT_EQ(std::as_const(args).getv("opt"), "1");
+
+	args.build_index();
+	EXPECT_EQ(args.positions_of('z').front(), 4u);
+	EXPECT_EQ(args.count<opt3::Flag>(), 3u);
+}
+
+// capture lists only check the minimum of groups that appeared, & count Parameters toward the group that shares their name
+TEST(opt3, CaptureListCountsParametersAndOnlyChecksGroupsThatAppeared)
+{
+	opt3::capture_list captures{
+		opt3::make_template(opt3::CaptureStyle::Required, 'f', "file").SetMin(2),
+		opt3::make_template(opt3::CaptureStyle::Disabled, 'v').SetMax(1),
+		opt3::make_template("help"),
+	};
+	EXPECT_EQ(opt3::parse({ "--help" }, captures, {}).size(), 1u);
+	EXPECT_THROW(opt3::parse({ "-f", "a" }, captures, {}), ex::except);
+	EXPECT_EQ(opt3::parse({ "-f", "a", "--file", "b" }, captures, {}).size(), 2u);
+
+	EXPECT_THROW(opt3::parse({ "-v", "v" }, captures, {}), ex::except);
+	const std::vector<std::string> args{ "-v", "v" };
+	EXPECT_THROW(opt3::parse_view(args, captures), ex::except);
+
+	// schemas check every group, & never count Parameters
+	constexpr auto strict{ opt3::make_schema(
+		opt3::schema_group{ "f", "file" }.SetCaptureStyle(opt3::CaptureStyle::Required).SetMin(2),
+		opt3::schema_group{ "v" }.SetCaptureStyle(opt3::CaptureStyle::Disabled).SetMax(1),
+		opt3::schema_group{ "help" }
+	) };
+	EXPECT_THROW(opt3::parse({ "--help" }, strict), ex::except);
+	EXPECT_EQ(opt3::parse({ "--help", "-f", "a", "--file", "b", "-v", "v" }, strict).size(), 5u);
+}
+
+TEST(opt3, StrictGroupCountsCheckEveryGroupAndIgnoreParameters)
+{
+	const opt3::capture_list captures{
+		opt3::make_template(opt3::CaptureStyle::Required, 'f', "file").SetMin(2),
+		opt3::make_template(opt3::CaptureStyle::Disabled, 'v').SetMax(1),
+		opt3::make_template("help"),
+	};
+	opt3::ArgParsingRules rules;
+	rules.strictGroupCounts = true;
+	EXPECT_THROW(opt3::parse({ "--help" }, captures, rules), ex::except);
+	EXPECT_EQ(opt3::parse({ "--help", "-f", "a", "--file", "b", "-v", "v" }, captures, rules).size(), 5u);
+
+	const std::vector<std::string> args{ "-f", "a", "-f", "b", "-v", "v" };
+	EXPECT_EQ(opt3::parse_view(args, captures, rules).size(), 4u);
+	EXPECT_THROW(opt3::parse_view(args, captures), ex::except);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <stat_cache.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+	/// @brief	Creates a temporary directory for a test's files, and removes it afterwards.
+	struct temp_dir {
+		std::filesystem::path dir;
+
+		temp_dir() : dir{ std::filesystem::temp_directory_path() / ("307lib_stat_cache_" + std::string{ ::testing::UnitTest::GetInstance()->current_test_info()->name() }) }
+		{
+			std::filesystem::create_directories(dir);
+		}
+		~temp_dir()
+		{
+			std::error_code ec;
+			std::filesystem::remove_all(dir, ec);
+		}
+
+		/// @brief	Creates (or replaces) a file that contains the given number of bytes.
+		std::filesystem::path make_file(std::string const& name, size_t const size) const
+		{
+			const auto& path{ dir / name };
+			std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(size, 'x');
+			return path;
+		}
+	};
+}
+
+TEST(stat_cache, StatMatchesStdFilesystem)
+{
+	temp_dir tmp;
+	const auto& file{ tmp.make_file("a.txt", 42) };
+	const auto& regular{ file::stat(file) };
+	EXPECT_FALSE(regular.error);
+	EXPECT_TRUE(regular.exists());
+	EXPECT_TRUE(regular.is_regular_file());
+	EXPECT_EQ(regular.size, 42u);
+	EXPECT_EQ(regular.mtime, std::filesystem::last_write_time(file));
+
+	const auto& directory{ file::stat(tmp.dir) };
+	EXPECT_FALSE(directory.error);
+	EXPECT_TRUE(directory.is_directory());
+	EXPECT_EQ(directory.size, 0u);
+
+	// files that don't exist aren't an error, even when a parent directory is missing too
+	for (const auto& path : { tmp.dir / "missing", tmp.dir / "missing" / "a.txt" }) {
+		const auto& missing{ file::stat(path) };
+		EXPECT_FALSE(missing.error) << path;
+		EXPECT_FALSE(missing.exists()) << path;
+		EXPECT_EQ(missing.type, std::filesystem::file_type::not_found) << path;
+	}
+
+	const std::vector<std::filesystem::path> paths{ tmp.dir / "missing", file, tmp.dir };
+	const auto& many{ file::stat_many(paths) };
+	ASSERT_EQ(many.size(), 3u);
+	EXPECT_FALSE(many[0].exists());
+	EXPECT_TRUE(many[1].is_regular_file());
+	EXPECT_TRUE(many[2].is_directory());
+}
+
+TEST(stat_cache, EntriesExpireAfterTheTTL)
+{
+	temp_dir tmp;
+	const auto& path{ tmp.make_file("a.txt", 1) };
+	file::stat_cache cache{ 200ms };
+	EXPECT_EQ(cache.file_size(path), 1u);
+
+	tmp.make_file("a.txt", 2);
+	EXPECT_EQ(cache.file_size(path), 1u); //< still cached
+
+	std::this_thread::sleep_for(300ms);
+	EXPECT_EQ(cache.file_size(path), 2u);
+}
+
+TEST(stat_cache, InvalidateRemovesTheEntry)
+{
+	temp_dir tmp;
+	const auto& path{ tmp.make_file("a.txt", 1) };
+	file::stat_cache cache{ 1h };
+	EXPECT_TRUE(cache.exists(path));
+	EXPECT_EQ(cache.size(), 1u);
+
+	std::filesystem::remove(path);
+	EXPECT_TRUE(cache.exists(path));
+	cache.invalidate(path);
+	EXPECT_FALSE(cache.exists(path));
+
+	tmp.make_file("a.txt", 3);
+	cache.clear();
+	EXPECT_EQ(cache.size(), 0u);
+	EXPECT_EQ(cache.file_size(path), 3u);
+}
+
+#ifndef _WIN32
+TEST(stat_cache, ErrorsAreNeverCached)
+{
+	// a path component that's longer than any filesystem allows fails with ENAMETOOLONG, rather than not being found
+	const auto& path{ std::filesystem::temp_directory_path() / std::string(1000, 'x') };
+	file::stat_cache cache{ 1h };
+	const auto& result{ cache.get(path) };
+	EXPECT_TRUE(result.error);
+	EXPECT_EQ(cache.size(), 0u);
+
+	const std::vector<std::filesystem::path> paths{ path, path };
+	for (const auto& it : cache.stat_many(paths))
+		EXPECT_TRUE(it.error);
+	EXPECT_EQ(cache.size(), 0u);
+}
+#endif
+
+TEST(stat_cache, FullCachesRemoveExpiredEntriesFirst)
+{
+	temp_dir tmp;
+	file::stat_cache cache{ 200ms, 4 };
+	cache.get(tmp.dir / "a");
+	cache.get(tmp.dir / "b");
+	std::this_thread::sleep_for(300ms);
+	cache.get(tmp.dir / "c");
+	cache.get(tmp.dir / "d");
+	ASSERT_EQ(cache.size(), 4u);
+
+	// a & b have expired, so only they are removed to make room
+	cache.get(tmp.dir / "e");
+	EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST(stat_cache, FullCachesAreClearedWhenNothingHasExpired)
+{
+	temp_dir tmp;
+	file::stat_cache cache{ 1h, 4 };
+	for (const char* name : { "a", "b", "c", "d" })
+		cache.get(tmp.dir / name);
+	ASSERT_EQ(cache.size(), 4u);
+
+	cache.get(tmp.dir / "e");
+	EXPECT_EQ(cache.size(), 1u);
+	// looking up an entry that's already cached doesn't add another one
+	cache.get(tmp.dir / "e");
+	EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(stat_cache, StatManyKeepsTheInputOrderWithMixedHitsAndMisses)
+{
+	temp_dir tmp;
+	std::vector<std::filesystem::path> paths;
+	for (size_t i{ 0 }; i < 5; ++i)
+		paths.emplace_back(tmp.make_file(std::to_string(i), i));
+
+	file::stat_cache cache{ 1h };
+	cache.get(paths[1]);
+	cache.get(paths[3]);
+
+	// change every file, so the results show which ones came from the cache
+	for (size_t i{ 0 }; i < paths.size(); ++i)
+		tmp.make_file(std::to_string(i), 10 + i);
+
+	const auto& results{ cache.stat_many(paths) };
+	ASSERT_EQ(results.size(), paths.size());
+	EXPECT_EQ(results[0].size, 10u);
+	EXPECT_EQ(results[1].size, 1u);
+	EXPECT_EQ(results[2].size, 12u);
+	EXPECT_EQ(results[3].size, 3u);
+	EXPECT_EQ(results[4].size, 14u);
+	EXPECT_EQ(cache.size(), paths.size());
+}
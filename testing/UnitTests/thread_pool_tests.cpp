@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include <chunked_file.hpp>
+#include <simpleINI.hpp>
+#include <thread_pool.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+TEST(thread_pool, RunsSubmittedTasks)
+{
+	std::atomic<int> sum{ 0 };
+	{
+		shared::thread_pool pool{ 3 };
+		EXPECT_EQ(pool.size(), 3u);
+		for (int i{ 1 }; i <= 100; ++i)
+			pool.submit([&sum](int n) { sum += n; }, i);
+		EXPECT_EQ(pool.submit([] { return 42; }).get(), 42);
+	} //< the destructor finishes the queue
+	EXPECT_EQ(sum, 5050);
+}
+
+TEST(thread_pool, ForwardsExceptionsThroughTheFuture)
+{
+	shared::thread_pool pool{ 1 };
+	auto future{ pool.submit([]() -> int { throw std::runtime_error{ "failed" }; }) };
+	EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(thread_pool, KnowsItsWorkerThreads)
+{
+	shared::thread_pool pool{ 2 }, other{ 1 };
+	EXPECT_FALSE(pool.is_worker_thread());
+	EXPECT_TRUE(pool.submit([&pool] { return pool.is_worker_thread(); }).get());
+	EXPECT_FALSE(other.submit([&pool] { return pool.is_worker_thread(); }).get());
+}
+
+// waiting for tasks on the pool that is running the caller would deadlock once every worker is waiting
+TEST(thread_pool, RejectsNestedWaitsOnTheSamePool)
+{
+	shared::thread_pool pool{ 1 }, other{ 1 };
+	const std::string buffer{ "a\nb\nc\n" };
+	const auto& countLines{ [&buffer](shared::thread_pool& p) {
+		return file::map_chunks(buffer, [](std::string_view const& chunk, file::byte_range const&) { return chunk.size(); }, p).size();
+	} };
+
+	EXPECT_THROW(pool.submit([&] { return countLines(pool); }).get(), ex::except);
+	EXPECT_THROW(pool.submit([&pool] { return ini::parse_files(std::vector<std::filesystem::path>{}, {}, pool).size(); }).get(), ex::except);
+	EXPECT_GE(pool.submit([&] { return countLines(other); }).get(), 1u);
+}
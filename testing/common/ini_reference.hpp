@@ -0,0 +1,197 @@
+/**
+ * @file	ini_reference.hpp
+ * @brief	Copies of the original line-by-line INI parser & stream printer, which are used as references by the equivalence tests & benchmarks.
+ *\n		These are intentionally left as they were before they were replaced; don't optimize them.
+ */
+#pragma once
+#include <simpleINI.hpp>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace ini_reference {
+	/// @returns	A string_view of the parameter 'line' that excludes any line comments.
+	template<class TKeyComparator>
+	inline std::string_view strip_comments(ini::ini_parser_config<TKeyComparator> const& config, std::string const& line) noexcept
+	{
+		bool escaped{ false }, single_quoted{ false }, double_quoted{ false };
+		for (size_t i{ 0 }, end{ line.size() }; i < end; ++i) {
+			const char& c{ line.at(i) };
+
+			if (escaped)
+				escaped = false;
+			else if (config.escapeChars.find(c) != std::string::npos)
+				escaped = true;
+			else if (c == '\'')
+				single_quoted = !single_quoted;
+			else if (c == '\"')
+				double_quoted = !double_quoted;
+			else if (!single_quoted && !double_quoted && config.commentChars.find(c) != std::string::npos)
+				return std::string_view{ line.begin(), line.begin() + i };
+		}
+		return std::string_view{ line };
+	}
+
+	/// @returns	A pair of iterators pointing to enclosing *(must be matching & both unescaped)* quotation marks in the given string, or { value.end(), value.end() }.
+	template<class TKeyComparator>
+	inline std::pair<std::string::const_iterator, std::string::const_iterator> find_enclosing_quotes(ini::ini_parser_config<TKeyComparator> const& config, std::string const& value) noexcept
+	{
+		size_t i;
+		char delim;
+		const auto& findDelim{ [&value, &i, &delim, &config](auto&& ch) {
+			const auto& idx{ i++ };
+			return (ch == delim && (idx == 0 || (idx > 0 && config.escapeChars.find(value.at(idx - 1)) == std::string::npos)));
+		} };
+
+		for (const char quote : { '\"', '\'' }) {
+			i = 0ull;
+			delim = quote;
+			if (const auto& fst{ std::find_if(value.begin(), value.end(), findDelim) }; fst != value.end())
+				if (const auto& snd{ std::find_if(fst + 1, value.end(), findDelim) }; snd != value.end())
+					return{ fst, snd };
+		}
+		return{ value.end(), value.end() };
+	}
+
+	/// @brief	The original implementation of ini::parse(std::istream&).
+	template<class TKeyComparator = ini::CaseInsensitiveCompare>
+	inline ini::ini_container<TKeyComparator> parse(std::istream& is, ini::ini_parser_config<TKeyComparator> const& config = {}) noexcept(false)
+	{
+		using namespace ini;
+		static const auto WHITESPACE{ " \t\v\r\n" };
+
+		const auto& maskIncludesHeader{ [&config](std::string const& header) { return config.mask.empty() || config.mask.contains(header); } };
+		const auto& maskIncludesKey{ [&config](std::string const& header, std::string const& key) { return config.mask.empty() || (config.mask.contains(header) && config.mask.at(header).contains(key)); } };
+
+		ini_container<TKeyComparator> ini{};
+
+		size_t ln{ 0 };
+
+		std::string header{};
+		bool skip_header{ false };
+
+		for (std::string line; std::getline(is, line, '\n'); is.clear(), ++ln) {
+			if (std::all_of(line.begin(), line.end(), str::stdpred::isspace)) continue;
+
+			auto l{ strip_comments(config, line) };
+
+			if (std::all_of(l.begin(), l.end(), str::stdpred::isspace)) continue;
+
+			// find headers
+			if (const size_t iOpen{ l.find('[') }, iClose{ l.rfind(']') };
+				iOpen != std::string::npos && iClose != std::string::npos) {
+				std::string tmpHeader{ l.substr(iOpen + 1, iClose - iOpen - 1) };
+
+				if (config.stripWhitespaceFromHeaders)
+					tmpHeader = str::trim(tmpHeader);
+
+				if (const size_t fstNonSpace{ l.find_first_not_of(WHITESPACE) }, lastNonSpace{ l.find_last_not_of(WHITESPACE) };
+					(iOpen > fstNonSpace || iClose < lastNonSpace) && config.syntaxErrorStyle == SyntaxErrorStyle::Throw)
+					throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " contains a header with preceding or trailing non-whitespace characters! '", line, "'");
+
+				skip_header = false;
+
+				if (!maskIncludesHeader(tmpHeader)) {
+					switch (config.maskStyle) {
+					case MaskStyle::Skip:
+						skip_header = true;
+						break;
+					case MaskStyle::Throw:
+						throw ex::make_custom_exception<ini_mask_exception>("Line ", ln, " contains an unexpected header: '", tmpHeader, "'!");
+					case MaskStyle::Disable: [[fallthrough]];
+					default:break;
+					}
+				}
+
+				header = tmpHeader;
+			}
+			else if (!skip_header) {
+				// find key-value pairs
+				if (const size_t equals{ l.find('=') }; equals != std::string::npos) {
+					if (const std::string key{ str::trim(std::string{ l.substr(0ull, equals) }) }; !key.empty()) {
+						auto& section{ ini[header] };
+
+						std::string value{ l.substr(equals + 1) };
+
+						if (config.stripWhitespaceFromValue)
+							value = str::trim(value);
+
+						// find enclosing quotes
+						if (const auto& [fst, snd] { find_enclosing_quotes(config, value) };
+							fst != value.end() && snd != value.end()) {
+							if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw) {
+								if (fst != value.begin() && !std::all_of<std::string::const_iterator>(value.begin(), fst, str::stdpred::isspace))
+									throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters before the opening quote: {", std::string_view{ value.begin(), fst }, "}!");
+								else if (snd != value.end() && !std::all_of<std::string::const_iterator>(snd + 1, value.end(), str::stdpred::isspace))
+									throw ex::make_custom_exception<ini_syntax_exception>("Line ", ln, " the setter for key '", key, "' specifies a quote-enclosed value, but there were unexpected characters after the closing quote: {", std::string_view{ snd + 1, value.end() }, "}!");
+							}
+
+							value = { fst + config.stripEnclosingQuotes, snd + !config.stripEnclosingQuotes };
+						}
+
+						if (!maskIncludesKey(header, key)) {
+							switch (config.maskStyle) {
+							case MaskStyle::Skip:
+								continue;
+							case MaskStyle::Throw:
+								throw ex::make_custom_exception<ini_mask_exception>("Line ", ln, " contains unexpected key '", key, "'", (header.empty() ? std::string{ " within section '" + header + "'!" } : "!"));
+							case MaskStyle::Disable: [[fallthrough]];
+							default: break;
+							}
+						}
+
+						if (section.contains(key)) {
+							switch (config.overrideStyle) {
+							case OverrideStyle::OnlyBlank:
+								if (!section.at(key).empty())
+									break;
+								else [[fallthrough]];
+							case OverrideStyle::Override:
+								section.at(key) = value;
+								break;
+							case OverrideStyle::Throw:
+								throw ex::make_custom_exception<ini_key_exception>("Line ", ln, " specifies a duplicate key '", value, "'; '", header, (header.empty() ? "" : "::"), key, "' already has value '", section.at(key), "'!");
+							case OverrideStyle::Skip: [[fallthrough]];
+							default:break;
+							}
+						}
+						else section.insert(std::make_pair(key, ini_value{ value }));
+					}
+					else if (config.syntaxErrorStyle == SyntaxErrorStyle::Throw)
+						throw ex::make_custom_exception<ini_syntax_exception>("Invalid key specified on line ", ln, ": \"", line, '\"');
+				}
+			}
+		}
+
+		if (config.addMaskToOutput)
+			deep_merge<TKeyComparator>(ini, config.mask, OverrideStyle::OnlyBlank);
+
+		return ini;
+	}
+
+	/// @brief	The original implementation of operator<<(std::ostream&, ini_printer const&), which inserts each token into the stream separately.
+	template<class TKeyComparator = ini::CaseInsensitiveCompare>
+	inline std::ostream& print(std::ostream& os, ini::ini_container<TKeyComparator> const& ini, bool const explicitGlobalHeader = false, bool const insertNewlineBetweenSections = true)
+	{
+		bool fst{ true }, fstHeader{ true };
+		for (const auto& [header, section] : ini) {
+			if (insertNewlineBetweenSections) {
+				if (fst) fst = false;
+				else os << '\n';
+			}
+
+			if (!header.empty() || !fstHeader || explicitGlobalHeader)
+				os << '[' << header << ']' << '\n';
+
+			for (const auto& [key, val] : section)
+				os << key << ' ' << '=' << ' ' << val << '\n';
+
+			fstHeader = false;
+		}
+		return os;
+	}
+}